@@ -13,6 +13,7 @@
 #include "behaviour.h"
 #include "tilt.h"
 #include "epaper.h"      // includes pet.h, pomodoro.h internally
+#include "scheduler.h"
 
 #if USE_SERVO_NUDGE
 #include "servo_arm.h"
@@ -28,8 +29,23 @@ static uint8_t tiltCounter  = 0;
 static uint32_t _lastDisplayMs  = 0;
 static const uint16_t DISPLAY_INTERVAL_MS = 300;
 static bool _needsRedraw = true;
+static uint32_t _shownSecs = TIMER_NO_CHANGE;   // countdown on the panel
+static const uint16_t DISPLAY_POLL_MS = 10;      // BUSY polling while a waveform runs
+
+// ── Tasks (table order = priority) ──────────────────────────
+enum TaskId { TASK_INPUT, TASK_IMU, TASK_SERVO, TASK_TIMERS, TASK_ANIM, TASK_DISPLAY,
+              TASK_STATS, TASK_COUNT };
+
+/* something on screen changed: let the display task pick it up */
+static void requestRedraw() {
+  _needsRedraw = true;
+  taskWake(TASK_DISPLAY);
+}
 
 // ── Transition logic ────────────────────────────────────────
+// Runs inside whichever task detected the change, so it only updates
+// state and queues the full refresh; the display task does the panel
+// work, the timers task the sensor reads and the stats task the dump.
 
 void transitionTo(AppMode newMode) {
   if (newMode == currentMode) return;
@@ -45,6 +61,7 @@ void transitionTo(AppMode newMode) {
 
   prevMode    = currentMode;
   currentMode = newMode;
+  _shownSecs  = TIMER_NO_CHANGE;
 
   /* rotation */
   int r = rotationForMode(currentMode, prevMode);
@@ -67,61 +84,81 @@ void transitionTo(AppMode newMode) {
       break;
   }
 
-  fullRefresh(currentMode);
+  queueFullRefresh(currentMode);
   _needsRedraw = false;
+  taskWake(TASK_ANIM);                 // new mood clip
+  taskWake(TASK_TIMERS);               // runs first: calendar / temperature
+  taskWake(TASK_DISPLAY);
+  taskWake(TASK_STATS);
 }
 
 // ═══════════════════════════════════════════════════════════
-//  SETUP
+//  TASKS
 // ═══════════════════════════════════════════════════════════
 
-void setup() {
-  Serial.begin(115200);
-  delay(200);
-  Serial.println(F("\n=== UniBuddy ==="));
+/* button, tap and motion events (the tap arrives via ISR; the button
+ * is polled for debounce and long-press) */
+static void taskInput() {
+  InputEvent evt = readInput();
 
-  initInput();
-  initTilt();
-  initBehaviour();
-  initPomodoro();
-  initDisplay();
-#if USE_SERVO_NUDGE
-  initServoArm();
-#endif
-  showSplashScreen();
-  delay(2000);
+  // ── Button events ─────────────────────────────────────────
+  if (evt == EVT_BTN_SHORT) {
+    if (currentMode == MODE_POMODORO && !isPomRunning()) {
+      startPomodoro();
+      taskWake(TASK_TIMERS);
+      requestRedraw();
+    }
+  }
+  if (evt == EVT_BTN_LONG) {
+    /* long-press in pet → reset sessions */
+    if (currentMode == MODE_PET) {
+      initBehaviour();
+      initPomodoro();
+      setPetMood(MOOD_HAPPY);
+      taskWake(TASK_ANIM);
+      requestRedraw();
+      Serial.println(F("[Btn] Reset sessions"));
+    }
+  }
 
-  /* first frame */
-  int r = rotationForMode(MODE_PET, MODE_PET);
-  setDisplayRotation(r);
-  fullRefresh(MODE_PET);
+  // ── Tap events ────────────────────────────────────────────
+  if (evt == EVT_TAP) {
+    if (currentMode == MODE_POMODORO) {
+      togglePausePomodoro();
+      Serial.print(F("[Pom] "));
+      Serial.println(isPomPaused() ? F("PAUSED") : F("RESUMED"));
+      taskWake(TASK_TIMERS);
+      requestRedraw();
+    } else if (currentMode == MODE_PET) {
+      setPetMood(MOOD_INTERESTED);
+      taskWake(TASK_ANIM);
+      requestRedraw();
+    }
+  }
+  if (evt == EVT_DOUBLE_TAP) {
+    /* double tap anywhere → toggle night mode */
+    toggleNightMode();
+    Serial.print(F("[Night] "));
+    Serial.println(isNightMode() ? F("ON") : F("OFF"));
+    requestRedraw();                   // inverted on upload, one partial
+  }
 }
 
-// ═══════════════════════════════════════════════════════════
-//  LOOP
-// ═══════════════════════════════════════════════════════════
-
-void loop() {
-  uint32_t now = millis();
-
-#if USE_SERVO_NUDGE
-  tickServoNudge();
-#endif
-
-  // ── 1. Read sensors ───────────────────────────────────────
+/* IMU sample at the sensor's output rate: shake reactions and
+ * tilt-based mode switching (debounced + hysteresis + shake-lockout) */
+static void taskImu() {
   updateTilt();
-  InputEvent evt = readInput();
 
-  // ── 2. Shake handling (pet mode only) ─────────────────────
   if (wasShakeDetected() && currentMode == MODE_PET) {
     onShake();
 #if USE_SERVO_NUDGE
     triggerNudge();
+    taskWake(TASK_SERVO);
 #endif
-    _needsRedraw = true;
+    taskWake(TASK_ANIM);
+    requestRedraw();
   }
 
-  // ── 3. Tilt-based mode switching (debounced + hysteresis + shake-lockout)
   if (isTiltReliable()) {
     AppMode tiltMode = classifyTilt(currentMode);
 
@@ -146,47 +183,19 @@ void loop() {
     /* tilt unreliable (shake lockout) — reset debounce */
     tiltCounter = 0;
   }
+}
 
-  // ── 4. Button events ─────────────────────────────────────
-  if (evt == EVT_BTN_SHORT) {
-    if (currentMode == MODE_POMODORO && !isPomRunning()) {
-      startPomodoro();
-      _needsRedraw = true;
-    }
-  }
-  if (evt == EVT_BTN_LONG) {
-    /* long-press in pet → reset sessions */
-    if (currentMode == MODE_PET) {
-      initBehaviour();
-      initPomodoro();
-      setPetMood(MOOD_HAPPY);
-      _needsRedraw = true;
-      Serial.println(F("[Btn] Reset sessions"));
-    }
-  }
-
-  // ── 5. Tap events ────────────────────────────────────────
-  if (evt == EVT_TAP) {
-    if (currentMode == MODE_POMODORO) {
-      togglePausePomodoro();
-      Serial.print(F("[Pom] "));
-      Serial.println(isPomPaused() ? F("PAUSED") : F("RESUMED"));
-      _needsRedraw = true;
-    } else if (currentMode == MODE_PET) {
-      setPetMood(MOOD_INTERESTED);
-      _needsRedraw = true;
-    }
-  }
-  if (evt == EVT_DOUBLE_TAP) {
-    /* double tap anywhere → toggle night mode */
-    toggleNightMode();
-    Serial.print(F("[Night] "));
-    Serial.println(isNightMode() ? F("ON") : F("OFF"));
-    fullRefresh(currentMode);          // full refresh for clean inversion
-    _needsRedraw = false;
-  }
+/* servo nudge steps; runs only while a nudge is in progress */
+static void taskServo() {
+#if USE_SERVO_NUDGE
+  tickServoNudge();
+  if (isNudging()) taskRunIn(TASK_SERVO, 20);
+#endif
+}
 
-  // ── 6. Pomodoro / break timers ────────────────────────────
+/* pomodoro / break timers, mood decay and the I2C sensor reads, once a
+ * second — on the timer's own second boundaries while one is running */
+static void taskTimers() {
   if (currentMode == MODE_POMODORO) {
     updatePomodoro();
     if (isPomodoroFinished()) {
@@ -194,6 +203,7 @@ void loop() {
       startBreak();
 #if USE_SERVO_NUDGE
       triggerNudge();
+      taskWake(TASK_SERVO);
 #endif
       transitionTo(MODE_BREAK);
     }
@@ -206,23 +216,136 @@ void loop() {
     }
   }
 
-  // ── 7. Pet idle mood decay ────────────────────────────────
+  /* sensors for the renderer and the transition waveform; the display
+   * task only reads the cached values */
+  if (currentMode == MODE_TEMPTIME_L || currentMode == MODE_TEMPTIME_R)
+    updateCalendarReadings();
+  updateAmbientTemp();
+
+  PetMood mood = getPetMood();
   tickPetIdleMood();
+  if (getPetMood() != mood) {
+    taskWake(TASK_ANIM);
+    if (currentMode == MODE_PET || currentMode == MODE_SLEEP)
+      requestRedraw();
+  }
 
-  // ── 8. Pet animation tick ─────────────────────────────────
-  if (currentMode == MODE_PET || currentMode == MODE_SLEEP) {
-    if (tickPetAnimation())
-      _needsRedraw = true;
+  if (currentMode == MODE_POMODORO || currentMode == MODE_BREAK) {
+    uint32_t ms = timerMsToNextSecond(currentMode, 0);
+    if (ms < 1000) taskRunIn(TASK_TIMERS, ms);
   }
+}
 
-  // ── 9. Display refresh ───────────────────────────────────
+/* pet animation: runs at the next keyframe of the mood clip */
+static void taskAnim() {
+  if (currentMode != MODE_PET && currentMode != MODE_SLEEP) return;
+  if (tickPetAnimation())
+    requestRedraw();
+  taskRunAt(TASK_ANIM, petNextFrameAt());
+}
+
+/* display: launches queued full refreshes, sends partials, and puts the
+ * controller to sleep until the next expected frame */
+static void taskDisplay() {
+  uint32_t now = millis();
+  tickDisplay();
   bool timerActive = (currentMode == MODE_POMODORO || currentMode == MODE_BREAK);
 
-  if (timerActive || _needsRedraw) {
-    if (now - _lastDisplayMs >= DISPLAY_INTERVAL_MS) {
+  /* timer screens refresh once per shown second, started one partial
+   * duration early so the new digits appear on the boundary */
+  uint32_t lead = displayPartialMs();
+  bool tick = timerActive && timerSecondsLeft(currentMode, lead) != _shownSecs;
+
+  /* only queue the next frame once the panel is free */
+  uint32_t wait = DISPLAY_INTERVAL_MS - (now - _lastDisplayMs);
+  if ((tick || _needsRedraw) && isDisplayReady()) {
+    if (tick || now - _lastDisplayMs >= DISPLAY_INTERVAL_MS) {
       _lastDisplayMs = now;
+      if (timerActive) _shownSecs = timerSecondsLeft(currentMode, lead);
       partialRefresh(currentMode);
       _needsRedraw = false;
+      tick = false;
     }
   }
+
+  /* controller deep sleep until the next expected frame */
+  uint32_t nextFrame = DISPLAY_NO_FRAME;
+  if (tick || _needsRedraw)
+    nextFrame = 0;
+  else if (timerActive) {
+    uint32_t ms = timerMsToNextSecond(currentMode, lead);
+    if (ms != TIMER_NO_CHANGE) nextFrame = ms;
+  } else if (currentMode == MODE_PET || currentMode == MODE_SLEEP)
+    nextFrame = petMsToNextFrame();
+  idleDisplay(nextFrame);
+
+  /* run again when BUSY may have dropped, when the rate limit opens,
+   * or at the next timer second; anything else wakes the task */
+  if (!isDisplayReady())
+    taskRunIn(TASK_DISPLAY, DISPLAY_POLL_MS);
+  else if (tick || _needsRedraw)
+    taskRunIn(TASK_DISPLAY, tick ? 0 : wait);
+  else if (timerActive && nextFrame != DISPLAY_NO_FRAME)
+    taskRunIn(TASK_DISPLAY, nextFrame);
+}
+
+/* panel and scheduler counters, printed after each mode change */
+static void taskStats() {
+  Serial.print(F("[EPD] asleep ")); Serial.print(displayAsleepMs() / 1000);
+  Serial.print(F(" s / ")); Serial.print(millis() / 1000);
+  Serial.print(F(" s, sleeps ")); Serial.println(displaySleepCount());
+  Serial.print(F("[EPD] frames ")); Serial.print(displayFramesIssued());
+  Serial.print(F(" sent, ")); Serial.print(displayFramesSkipped());
+  Serial.println(F(" skipped"));
+  printTaskStats();
+}
+
+static Task _taskTable[TASK_COUNT] = {
+  // name      fn           period ms  deadline ms  budget us
+  { "input",   taskInput,   10,        10,            500 },
+  { "imu",     taskImu,     10,        10,           2000 },  // LSM6DSOX at 104 Hz
+  { "servo",   taskServo,    0,        10,            500 },
+  { "timers",  taskTimers,  1000,      20,           1000 },
+  { "anim",    taskAnim,     0,        20,            200 },
+  { "display", taskDisplay,  0,        20,          60000 },  // render + SPI upload
+  { "stats",   taskStats,    0,      1000,          20000 },  // Serial dump
+};
+
+// ═══════════════════════════════════════════════════════════
+//  SETUP
+// ═══════════════════════════════════════════════════════════
+
+void setup() {
+  Serial.begin(115200);
+  delay(200);
+  Serial.println(F("\n=== UniBuddy ==="));
+
+  initInput();
+  initTilt();
+  initBehaviour();
+  initPomodoro();
+  initDisplay();
+#if USE_SERVO_NUDGE
+  initServoArm();
+#endif
+  showSplashScreen();
+  delay(2000);
+
+  /* first frame */
+  updateAmbientTemp();
+  int r = rotationForMode(MODE_PET, MODE_PET);
+  setDisplayRotation(r);
+  fullRefresh(MODE_PET);
+
+  schedulerBegin(_taskTable, TASK_COUNT);
+  taskWake(TASK_ANIM);
+  taskWake(TASK_DISPLAY);
+}
+
+// ═══════════════════════════════════════════════════════════
+//  LOOP
+// ═══════════════════════════════════════════════════════════
+
+void loop() {
+  schedulerRunOne();
 }
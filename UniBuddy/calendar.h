@@ -26,6 +26,7 @@ static bool         _rtcReady    = false;
 static ModulinoThermo _thermo;
 static bool         _thermoReady = false;
 static uint32_t     _lastCalReadMs = 0;
+static uint32_t     _lastTempReadMs = 0;  // any _tempC refresh, either path
 
 // ── Helpers ─────────────────────────────────────────────────
 
@@ -67,6 +68,22 @@ void initCalendarSensors() {
   }
 }
 
+// ── Ambient temperature for the display driver ─────────────
+// Sampled from the timers task, at most every AMBIENT_TEMP_MS (a
+// calendar poll counts as a sample). The display driver only reads
+// the cached value, so starting a refresh does no I2C.
+static const uint32_t AMBIENT_TEMP_MS = 10000;
+
+void updateAmbientTemp() {
+  uint32_t nowMs = millis();
+  if (!_thermoReady) return;
+  if (!isnan(_tempC) && nowMs - _lastTempReadMs < AMBIENT_TEMP_MS) return;
+  _tempC = _thermo.getTemperature();
+  _lastTempReadMs = nowMs;
+}
+
+float ambientTempC() { return _tempC; }
+
 // ── Poll — call periodically (rate-limited to 1 Hz) ────────
 
 void updateCalendarReadings() {
@@ -78,6 +95,7 @@ void updateCalendarReadings() {
   if (_thermoReady) {
     _tempC  = _thermo.getTemperature();
     _humPct = _thermo.getHumidity();
+    _lastTempReadMs = nowMs;
   }
 
   // RTC
@@ -33,6 +33,18 @@ enum AppMode {
 #define DISPLAY_HEIGHT    122
 #define PORTRAIT_WIDTH    122     // portrait
 #define PORTRAIT_HEIGHT   250
+#define USE_CUSTOM_LUT    1       // 0 = built-in OTP waveform for partials
+#ifndef EPD_BANDED_RENDER
+#define EPD_BANDED_RENDER 0       // 1 = draw in 25-row strips, no 8 KB frame + shadow
+#endif
+#define EPD_GHOST_BUDGET  30      // partials a 25-row strip may take before it is cleaned
+#define EPD_SLEEP_HORIZON_MS 1000 // deep-sleep the controller if no frame is due sooner
+#define EPD_PARTIAL_MS    400     // first guess of partialRefresh() -> BUSY low, then measured
+
+// Mode-transition refresh by ambient temperature (Modulino Thermo, °C)
+#define EPD_FAST_WARM_C        20     // >= : shortest FAST waveform (100 °C table)
+#define EPD_FAST_MIN_C         10     // >= : FAST at measured + boost; below: FULL
+#define EPD_FAST_BOOST_C       25     // table offset in the mild band
 
 // ── Pomodoro durations (ms) ─────────────────────────────────
 #ifdef TEST_MODE
@@ -15,6 +15,7 @@
 #include "config.h"
 #include "epd2in13_V4.h"
 #include "epdpaint.h"
+#include "sprites.h"
 #include "pet.h"
 #include "pomodoro.h"
 #include "behaviour.h"
@@ -27,25 +28,201 @@
 #define W  COL_WHITE
 
 // ── Night mode state ────────────────────────────────────────
+// Screens always render black on white. Night mode inverts the frame
+// on its way to the controller (the SPI mask of the RAM uploads), so
+// drawers never look at it except to add the night-sky decorations.
 static bool _nightMode = false;
 
 void  setNightMode(bool on) { _nightMode = on; }
 bool  isNightMode()          { return _nightMode; }
 void  toggleNightMode()      { _nightMode = !_nightMode; }
 
-/* dynamic foreground / background for night-aware drawing */
-static inline int FG() { return _nightMode ? W : B; }
-static inline int BG() { return _nightMode ? B : W; }
-
 static Epd epd;
-static unsigned char _fb[128 / 8 * 250];
-static Paint paint(_fb, 128, 250);
-
-static int  _partialCount = 0;
-static const int PARTIAL_LIMIT = 30;
+static const int FB_STRIDE = 128 / 8;
+static const int FB_ROWS   = 250;
+
+// ── Ghosting budget ─────────────────────────────────────────
+// Every GHOST_REGION_ROWS-row strip of the panel counts the partial
+// refreshes that changed it since it was last driven through a full
+// swing. A strip that reaches EPD_GHOST_BUDGET is cleaned in the next
+// partial: its old RAM (0x26) gets the inverted image so every pixel in
+// it transitions, and that refresh runs the WF_CLEAN waveform. WF_CLEAN
+// leaves black->black and white->white idle, so only the due strip (and
+// whatever actually changed elsewhere) swings; static strips stay put.
+static const int GHOST_REGION_ROWS = 25;
+static const int GHOST_REGIONS = (FB_ROWS + GHOST_REGION_ROWS - 1) / GHOST_REGION_ROWS;
+static uint8_t _flips[GHOST_REGIONS];
+
+#if EPD_BANDED_RENDER
+// ── Banded rendering ────────────────────────────────────────
+// Only one strip of BAND_ROWS panel rows is held in RAM. Every frame
+// is drawn once per band (primitives outside the band return early)
+// and each band is streamed straight into controller RAM. A hash per
+// band stands in for the shadow frame: unchanged bands are not sent.
+static const int BAND_ROWS = GHOST_REGION_ROWS;   // band b == ghost region b
+static const int BAND_COUNT = GHOST_REGIONS;
+static unsigned char _fb[FB_STRIDE * BAND_ROWS];
+static uint32_t _bandHash[BAND_COUNT];
+#else
+static unsigned char _fb[FB_STRIDE * FB_ROWS];
+
+// ── Dirty-rectangle tracking ────────────────────────────────
+// _shadow mirrors controller RAM 0x24 (what the panel last received).
+// Partial refreshes diff _fb against it and upload only the changed
+// byte-aligned windows.
+static unsigned char _shadow[sizeof(_fb)];
+
+struct DirtyRect {
+  uint8_t x0, x1;      // byte columns, inclusive
+  uint8_t y0, y1;      // panel rows, inclusive
+};
+static const uint8_t MAX_DIRTY_RECTS = 4;
+static const uint8_t DIRTY_MERGE_ROWS = 8;   // join boxes closer than this
+static DirtyRect _dirty[MAX_DIRTY_RECTS];
+
+// Rows Paint drew into the frame now in _shadow (empty when y1 < y0).
+// Everything else is background, so the next diff only has to scan
+// the rows either frame drew on.
+static int16_t _shownY0 = 0, _shownY1 = FB_ROWS - 1;
+#endif
+
+// Polarity of the image in controller RAM: the SPI mask it was
+// uploaded with (0xFF = night). _fb and _shadow are always day.
+static uint8_t _ramMask = 0x00;
+static Paint paint(_fb, 128, FB_ROWS);
+
+// ── Display list ────────────────────────────────────────────
+// Screen drawers draw through `gfx`, which records one DrawOp per
+// primitive: its bounds (rotated coordinates, inclusive) and a hash of
+// its opcode and parameters. Each frame is drawn twice: recording, to
+// diff the list against the previous frame's, then rasterising with
+// Paint clipped to each damaged box. An identical list means an
+// identical frame, and nothing is drawn at all.
+struct DrawOp {
+  int16_t  x0, y0, x1, y1;
+  uint32_t sig;
+};
+struct DamageBox {
+  int16_t x0, y0, x1, y1;  // rotated coordinates, inclusive
+};
+static const uint8_t MAX_DRAW_OPS = 64;
+static const uint8_t MAX_DAMAGE   = 4;
+static const uint8_t DAMAGE_ALL   = 0xFF;  // redraw everything
+
+static DrawOp    _ops[2][MAX_DRAW_OPS];    // this frame's and the last one's
+static uint8_t   _opCount[2];
+static uint8_t   _opList   = 0;            // list being recorded
+static int16_t   _opScreen = -1;           // screen of the last list, -1 = unusable
+static bool      _opFull   = false;        // list overflowed
+static DamageBox _damage[MAX_DAMAGE];
+
+class Canvas {
+public:
+  bool recording = false;
+  DamageBox clip = { -32768, -32768, 32767, 32767 };
+
+  void DrawFilledCircle(int x, int y, int r, int col) {
+    if (op(1, x - r, y - r, x + r, y + r, col)) paint.DrawFilledCircle(x, y, r, col);
+  }
+  void DrawCircle(int x, int y, int r, int col) {
+    if (op(2, x - r, y - r, x + r, y + r, col)) paint.DrawCircle(x, y, r, col);
+  }
+  void DrawFilledRectangle(int x0, int y0, int x1, int y1, int col) {
+    if (op(3, lo(x0, x1), lo(y0, y1), hi(x0, x1), hi(y0, y1), col))
+      paint.DrawFilledRectangle(x0, y0, x1, y1, col);
+  }
+  void DrawRectangle(int x0, int y0, int x1, int y1, int col) {
+    if (op(4, lo(x0, x1), lo(y0, y1), hi(x0, x1), hi(y0, y1), col))
+      paint.DrawRectangle(x0, y0, x1, y1, col);
+  }
+  void DrawHorizontalLine(int x, int y, int w, int col) {
+    if (op(5, x, y, x + w - 1, y, col)) paint.DrawHorizontalLine(x, y, w, col);
+  }
+  void DrawLine(int x0, int y0, int x1, int y1, int col) {
+    /* the box does not say which diagonal: hash the start point too */
+    uint32_t h = mix(mix(col, x0), y0);
+    if (op(6, lo(x0, x1), lo(y0, y1), hi(x0, x1), hi(y0, y1), h))
+      paint.DrawLine(x0, y0, x1, y1, col);
+  }
+  void DrawThickLine(int x0, int y0, int x1, int y1, int t, int col) {
+    uint32_t h = mix(mix(mix(col, x0), y0), t);
+    if (op(7, lo(x0, x1) - t, lo(y0, y1) - t, hi(x0, x1) + t, hi(y0, y1) + t, h))
+      paint.DrawThickLine(x0, y0, x1, y1, t, col);
+  }
+  void DrawStringAt(int x, int y, const char* text, sFONT* font, int col) {
+    uint32_t h = mix(col, (uint32_t)(uintptr_t)font);
+    int len = 0;
+    for (const char* c = text; *c; c++, len++) h = mix(h, (uint8_t)*c);
+    if (len && op(8, x, y, x + len * font->Width - 1, y + font->Height - 1, h))
+      paint.DrawStringAt(x, y, text, font, col);
+  }
+  void DrawBitmap(int x, int y, const unsigned char* bits, int w, int h, int rop,
+                  const unsigned char* mask, const unsigned char* bits_rot = NULL,
+                  const unsigned char* mask_rot = NULL) {
+    uint32_t s = mix(mix(rop, (uint32_t)(uintptr_t)bits), (uint32_t)(uintptr_t)mask);
+    if (op(9, x, y, x + w - 1, y + h - 1, s))
+      paint.DrawBitmap(x, y, bits, w, h, rop, mask, bits_rot, mask_rot);
+  }
 
-static uint8_t  _sleepFrame  = 0;
-static uint32_t _sleepTimer  = 0;
+private:
+  static int lo(int a, int b) { return a < b ? a : b; }
+  static int hi(int a, int b) { return a > b ? a : b; }
+  static uint32_t mix(uint32_t h, uint32_t v) { return (h ^ v) * 16777619UL; }
+
+  /* recording: append to the list. Rasterising: true if the primitive
+   * touches the box being redrawn */
+  bool op(uint8_t code, int x0, int y0, int x1, int y1, uint32_t extra) {
+    if (!recording)
+      return x1 >= clip.x0 && x0 <= clip.x1 && y1 >= clip.y0 && y0 <= clip.y1;
+    uint8_t& n = _opCount[_opList];
+    if (n == MAX_DRAW_OPS) { _opFull = true; return false; }
+    DrawOp& o = _ops[_opList][n++];
+    o.x0 = x0; o.y0 = y0; o.x1 = x1; o.y1 = y1;
+    o.sig = mix(2166136261UL ^ code, extra);
+    return false;
+  }
+};
+static Canvas gfx;
+
+// ── Async refresh state ─────────────────────────────────────
+// Refreshes are started with epd.BeginRefresh() and finish in the
+// background; loop() keeps running and polls BUSY via tickDisplay().
+static bool   _refreshing = false;
+static int8_t _queuedFull = -1;        // mode waiting for a full refresh
+
+// How long a partial takes from partialRefresh() to BUSY low (render,
+// upload and waveform), smoothed over the last few. Timer screens are
+// drawn this far ahead so the digits land on the second boundary, so
+// only plain WF_TIMER partials feed it: ghost cleans, night flips and
+// pet frames run other waveforms and would skew the lead.
+static bool     _refreshTimed = false; // the running waveform is a timer partial
+static uint32_t _refreshStart = 0;
+static uint16_t _partialMs    = EPD_PARTIAL_MS;
+
+// ── Controller power ────────────────────────────────────────
+// Between frames the SSD1680 goes into deep sleep (mode 1, RAM kept)
+// when the app expects no frame within EPD_SLEEP_HORIZON_MS. Every
+// refresh path starts with epd.Init(), which resets the controller
+// when it is not in an open session, so waking needs no extra step.
+static const uint32_t DISPLAY_NO_FRAME = 0xFFFFFFFFUL;
+static bool     _epdAsleep    = false;
+static uint32_t _asleepSince  = 0;
+static uint32_t _asleepMs     = 0;     // completed sleep periods
+static uint16_t _sleepCount   = 0;
+
+// ── Refresh counters ────────────────────────────────────────
+// Partial frames that reached uploadFrame(): issued ones ran a
+// waveform, skipped ones matched what the panel already shows (an
+// unchanged display list, or no pixel that differs from _shadow /
+// the band hashes) and cost no SPI traffic and no BUSY wait.
+static uint32_t _framesIssued  = 0;
+static uint32_t _framesSkipped = 0;
+
+// Per-frame timer reading, sampled once in prepareFrame() so every
+// band of a banded render shows the same second.
+static uint32_t _frameSecs = 0;        // timer seconds left (focus / break)
+
+static const int SCREEN_SPLASH = -1;   // renderToBuffer() pseudo-mode
 
 // forward decls
 void drawPetFace();
@@ -54,6 +231,7 @@ void drawTempCalPortrait();
 void drawFocusScreen();
 void drawBreakScreen();
 void renderToBuffer(int mode);
+void drawScreen(int mode);
 
 // ═══════════════════════════════════════════════════════════
 //  Init / splash / refresh
@@ -69,52 +247,397 @@ void initDisplay() {
 
 void setDisplayRotation(int r) { paint.SetRotate(r); }
 
+void drawSplash() {
+  gfx.DrawStringAt(40, 12, "UniBuddy", &Font24, B);
+  gfx.DrawHorizontalLine(30, 42, 190, B);
+  gfx.DrawStringAt(42, 50, "Tilt to switch!", &Font16, B);
+  gfx.DrawStringAt(15, 76,  "Stand -> Pet   Flat -> Sleep", &Font12, B);
+  gfx.DrawStringAt(15, 92,  "Tilt -> Info   Flip -> Focus", &Font12, B);
+  gfx.DrawStringAt(15, 108, "Shake/Tap me! 2xTap->Night", &Font12, B);
+}
+
+/* sample the timer once per frame, before any band is drawn, as of the
+ * end of the waveform rather than its start. Sensors are read by the
+ * caller (calendar readings on entering the info screen), so rendering
+ * does no I2C */
+static void prepareFrame(int mode) {
+  switch (mode) {
+    case MODE_POMODORO:
+    case MODE_BREAK:      _frameSecs = timerSecondsLeft(mode, _partialMs); break;
+    default: break;
+  }
+}
+
+#if !EPD_BANDED_RENDER
+/* compare rows y0..y1 of _fb with _shadow and collect the changed
+ * byte-aligned bounding boxes into _dirty; returns the box count */
+uint8_t diffFrame(int y0, int y1) {
+  uint8_t n = 0;
+  for (int y = y0; y <= y1; y++) {
+    const unsigned char* a = &_fb[y * FB_STRIDE];
+    const unsigned char* b = &_shadow[y * FB_STRIDE];
+    if (memcmp(a, b, FB_STRIDE) == 0) continue;
+
+    uint8_t x0 = 0, x1 = FB_STRIDE - 1;
+    while (a[x0] == b[x0]) x0++;
+    while (a[x1] == b[x1]) x1--;
+
+    DirtyRect* r = n ? &_dirty[n - 1] : NULL;
+    if (r && (y - r->y1 <= DIRTY_MERGE_ROWS || n == MAX_DIRTY_RECTS)) {
+      if (x0 < r->x0) r->x0 = x0;
+      if (x1 > r->x1) r->x1 = x1;
+      r->y1 = y;
+    } else {
+      _dirty[n].x0 = x0; _dirty[n].x1 = x1;
+      _dirty[n].y0 = y;  _dirty[n].y1 = y;
+      n++;
+    }
+  }
+  return n;
+}
+#endif
+
+/* partial-refresh waveform per screen: short phase for pet frames,
+ * balanced for timer digits, full swing for the rarely-updated info screen */
+const unsigned char* waveformForMode(int mode) {
+  switch (mode) {
+    case MODE_PET:
+    case MODE_SLEEP:      return WF_ANIM_2IN13_V4;
+    case MODE_POMODORO:
+    case MODE_BREAK:      return WF_TIMER_2IN13_V4;
+    default:              return WF_CLEAN_2IN13_V4;
+  }
+}
+
+/* bit g set = ghost region g has used up its budget */
+static uint16_t ghostRegionsDue() {
+  uint16_t due = 0;
+  for (int g = 0; g < GHOST_REGIONS; g++)
+    if (_flips[g] >= EPD_GHOST_BUDGET) due |= 1u << g;
+  return due;
+}
+
+/* count one partial refresh against every region rows y0..y1 touch */
+static void noteFlips(int y0, int y1) {
+  for (int g = y0 / GHOST_REGION_ROWS; g <= y1 / GHOST_REGION_ROWS; g++)
+    if (_flips[g] < 255) _flips[g]++;
+}
+
+/* bookkeeping only: the Init() that follows performs the reset */
+static void wakeDisplay() {
+  if (!_epdAsleep) return;
+  _asleepMs += millis() - _asleepSince;
+  _epdAsleep = false;
+}
+
+/* start (or continue) the partial session; a refresh that cleans a
+ * region runs WF_CLEAN, which only drives pixels that transition */
+static void openPartial(int mode, bool clean) {
+  _refreshTimed = !clean && waveformForMode(mode) == WF_TIMER_2IN13_V4;
+  wakeDisplay();
+  epd.Init(PART);
+#if USE_CUSTOM_LUT
+  epd.SetLut(clean ? WF_CLEAN_2IN13_V4 : waveformForMode(mode));
+#endif
+}
+
+#if EPD_BANDED_RENDER
+static uint32_t hashBand(int bytes) {
+  uint32_t h = 2166136261UL;                 // FNV-1a
+  for (int i = 0; i < bytes; i++) h = (h ^ _fb[i]) * 16777619UL;
+  return h;
+}
+#endif
+
+/* grow the damage list by box (x0, y0)..(x1, y1), merged into a box it
+ * overlaps; once the list is full it joins the last box */
+static void addDamage(uint8_t& n, int x0, int y0, int x1, int y1) {
+  DamageBox* d = NULL;
+  for (uint8_t i = 0; i < n && !d; i++)
+    if (x1 >= _damage[i].x0 && x0 <= _damage[i].x1 &&
+        y1 >= _damage[i].y0 && y0 <= _damage[i].y1) d = &_damage[i];
+  if (!d && n == MAX_DAMAGE) d = &_damage[n - 1];
+  if (!d) {
+    _damage[n].x0 = x0; _damage[n].y0 = y0;
+    _damage[n].x1 = x1; _damage[n].y1 = y1;
+    n++;
+    return;
+  }
+  if (x0 < d->x0) d->x0 = x0;
+  if (y0 < d->y0) d->y0 = y0;
+  if (x1 > d->x1) d->x1 = x1;
+  if (y1 > d->y1) d->y1 = y1;
+}
+
+/* record `mode` into the display list and diff it against the previous
+ * frame's, op by op: a changed op damages its old and its new bounds.
+ * Returns the number of boxes in _damage (0 = nothing changed), or
+ * DAMAGE_ALL when there is no comparable previous list */
+static uint8_t recordFrame(int mode) {
+  int16_t screen = (mode + 1) * 4 + paint.GetRotate();
+  uint8_t prev = _opList;
+  _opList ^= 1;
+  _opCount[_opList] = 0;
+  _opFull = false;
+  gfx.recording = true;
+  drawScreen(mode);
+  gfx.recording = false;
+
+  bool comparable = _opScreen == screen && !_opFull;
+  _opScreen = _opFull ? -1 : screen;
+  if (!comparable) return DAMAGE_ALL;
+
+  uint8_t n = 0;
+  const DrawOp* a = _ops[prev];
+  const DrawOp* b = _ops[_opList];
+  uint8_t na = _opCount[prev], nb = _opCount[_opList];
+  for (uint8_t i = 0; i < na || i < nb; i++) {
+    if (i < na && i < nb && a[i].sig == b[i].sig &&
+        a[i].x0 == b[i].x0 && a[i].y0 == b[i].y0 &&
+        a[i].x1 == b[i].x1 && a[i].y1 == b[i].y1) continue;
+    if (i < na) addDamage(n, a[i].x0, a[i].y0, a[i].x1, a[i].y1);
+    if (i < nb) addDamage(n, b[i].x0, b[i].y0, b[i].x1, b[i].y1);
+  }
+  return n;
+}
+
+/* panel rows covered by a damage box; false if it is off screen */
+static bool damageRows(const DamageBox& d, int* y0, int* y1) {
+  int x0, x1;
+  paint.SetClip(d.x0, d.y0, d.x1, d.y1);
+  bool on = paint.GetClip(&x0, y0, &x1, y1);
+  paint.ResetClip();
+  return on;
+}
+
+#if !EPD_BANDED_RENDER
+/* redraw the n damaged boxes over the previous frame in _fb: clear each
+ * one and replay the ops that touch it. *top..*bottom get the panel
+ * rows that may have changed (empty when *bottom < *top) */
+static void renderDamage(int mode, uint8_t n, int* top, int* bottom) {
+  *top = FB_ROWS;
+  *bottom = -1;
+  for (uint8_t i = 0; i < n; i++) {
+    int y0, y1;
+    if (!damageRows(_damage[i], &y0, &y1)) continue;
+    if (y0 < *top) *top = y0;
+    if (y1 > *bottom) *bottom = y1;
+    paint.SetClip(_damage[i].x0, _damage[i].y0, _damage[i].x1, _damage[i].y1);
+    gfx.clip = _damage[i];
+    paint.Clear(W);
+    drawScreen(mode);
+  }
+  paint.ResetClip();
+  gfx.clip = Canvas().clip;
+}
+#endif
+
+/* render `mode` and write it into controller RAM. base = before a full
+ * refresh: write the whole frame to both RAMs and reset the ghost
+ * budget. Otherwise only changed regions go to RAM 0x24, plus any ghost
+ * region that is due for a clean, opening the partial session on the
+ * first one. A night-mode toggle makes every region due, so the
+ * inverted frame goes out as one full-swing partial. Only the parts
+ * of the frame whose display-list ops changed are redrawn. Returns the
+ * number of windows written; 0 means the frame is identical to what
+ * the panel shows. */
+static uint8_t uploadFrame(int mode, bool base) {
+  uint8_t n = 0;
+  uint8_t mask = (_nightMode && mode != SCREEN_SPLASH) ? 0xFF : 0x00;
+  bool flip = !base && mask != _ramMask;
+  uint16_t due = base ? 0 : flip ? (1u << GHOST_REGIONS) - 1 : ghostRegionsDue();
+  _ramMask = mask;
+  prepareFrame(mode);
+  if (base) memset(_flips, 0, sizeof(_flips));
+  uint8_t damage = recordFrame(mode);
+  if (base) damage = DAMAGE_ALL;
+#if EPD_BANDED_RENDER
+  uint16_t touched = 0;                      // bands under a damage box
+  for (uint8_t i = 0; damage != DAMAGE_ALL && i < damage; i++) {
+    int y0, y1;
+    if (damageRows(_damage[i], &y0, &y1))
+      for (int b = y0 / BAND_ROWS; b <= y1 / BAND_ROWS; b++) touched |= 1u << b;
+  }
+  for (int b = 0; b < BAND_COUNT; b++) {
+    int top  = b * BAND_ROWS;
+    int rows = FB_ROWS - top < BAND_ROWS ? FB_ROWS - top : BAND_ROWS;
+    bool clean = due & (1u << b);
+    if (damage != DAMAGE_ALL && !clean && !(touched & (1u << b))) continue;
+    paint.SetBand(top, rows);
+    renderToBuffer(mode);
+    uint32_t h = hashBand(rows * FB_STRIDE);
+    if (!base && !clean && h == _bandHash[b]) continue;
+    _bandHash[b] = h;
+    if (!base && n == 0) openPartial(mode, due != 0);
+    epd.WriteRamRows(0x24, top, rows, _fb, mask);
+    if (base || clean) epd.WriteRamRows(0x26, top, rows, _fb, clean ? ~mask : mask);
+    if (clean) _flips[b] = 0;
+    else if (!base) noteFlips(top, top + rows - 1);
+    n++;
+  }
+#else
+  int from = 0, to = FB_ROWS - 1;
+  if (damage == DAMAGE_ALL) {
+    paint.ResetDirty();
+    renderToBuffer(mode);
+    int x0, y0, x1, y1;
+    if (!paint.GetDirty(&x0, &y0, &x1, &y1)) { y0 = FB_ROWS; y1 = -1; }
+    if (!base) {
+      from = y0 < _shownY0 ? y0 : _shownY0;
+      to   = y1 > _shownY1 ? y1 : _shownY1;
+    }
+    _shownY0 = y0; _shownY1 = y1;
+  } else {
+    renderDamage(mode, damage, &from, &to);
+    if (from < _shownY0) _shownY0 = from;    // stays a superset of the
+    if (to > _shownY1) _shownY1 = to;        // rows the frame draws on
+  }
+  if (base) {
+    epd.WriteBaseImage(_fb, mask);
+    n = 1;
+  } else {
+    n = flip ? 0 : diffFrame(from, to);   // the cleans below send every row
+    if (n == 0 && !due) return 0;
+    openPartial(mode, due != 0);
+    for (uint8_t i = 0; i < n; i++) {
+      const DirtyRect& r = _dirty[i];
+      epd.WritePartWindow(r.x0 * 8, r.y0, (r.x1 - r.x0 + 1) * 8,
+                          r.y1 - r.y0 + 1, _fb, mask);
+      noteFlips(r.y0, r.y1);
+    }
+    for (int g = 0; g < GHOST_REGIONS; g++) {
+      if (!(due & (1u << g))) continue;
+      int top  = g * GHOST_REGION_ROWS;
+      int rows = FB_ROWS - top < GHOST_REGION_ROWS ? FB_ROWS - top : GHOST_REGION_ROWS;
+      epd.WriteRamRows(0x26, top, rows, &_fb[top * FB_STRIDE], ~mask);
+      epd.WriteRamRows(0x24, top, rows, &_fb[top * FB_STRIDE], mask);
+      _flips[g] = 0;
+      n++;
+    }
+  }
+  if (from <= to)
+    memcpy(&_shadow[from * FB_STRIDE], &_fb[from * FB_STRIDE], (to - from + 1) * FB_STRIDE);
+#endif
+  return n;
+}
+
 void showSplashScreen() {
-  paint.Clear(W);
-  paint.DrawStringAt(40, 12, "UniBuddy", &Font24, B);
-  paint.DrawHorizontalLine(30, 42, 190, B);
-  paint.DrawStringAt(42, 50, "Tilt to switch!", &Font16, B);
-  paint.DrawStringAt(15, 76,  "Stand -> Pet   Flat -> Sleep", &Font12, B);
-  paint.DrawStringAt(15, 92,  "Tilt -> Info   Flip -> Focus", &Font12, B);
-  paint.DrawStringAt(15, 108, "Shake/Tap me! 2xTap->Night", &Font12, B);
-  epd.Display(_fb);
+  uploadFrame(SCREEN_SPLASH, true);
+  epd.BeginRefresh(FULL);
+  epd.WaitUntilIdle();
+}
+
+/* true while the panel is still running a waveform */
+bool isDisplayBusy() {
+  if (_refreshing && epd.IsRefreshDone()) {
+    _refreshing = false;
+    if (_refreshTimed)
+      _partialMs = (3UL * _partialMs + (millis() - _refreshStart)) / 4;
+  }
+  return _refreshing;
+}
+
+/* panel idle and nothing queued — safe to start a new frame */
+bool isDisplayReady() { return !isDisplayBusy() && _queuedFull < 0; }
+
+/* init for a mode-transition refresh: the fastest OTP waveform that is
+ * still clean at the measured temperature, FULL when cold or unknown */
+char initTransitionRefresh() {
+  float t = ambientTempC();
+  wakeDisplay();
+  if (isnan(t) || t < EPD_FAST_MIN_C) {
+    epd.Init(FULL);
+    return FULL;
+  }
+  epd.InitFast(t >= EPD_FAST_WARM_C ? 100 : (int)t + EPD_FAST_BOOST_C);
+  return FAST;
+}
+
+static void startFullRefresh(int mode) {
+  char wf = initTransitionRefresh();
+  uploadFrame(mode, true);
+  epd.BeginRefresh(wf);
+  _refreshing   = true;
+  _refreshTimed = false;
 }
 
-void deepRefresh(int mode) {
-  epd.Init(FULL); renderToBuffer(mode);
-  epd.DisplayPartBaseImage(_fb); _partialCount = 0;
+/* call every loop(): launches a queued full refresh once BUSY drops */
+void tickDisplay() {
+  if (isDisplayBusy() || _queuedFull < 0) return;
+  int mode = _queuedFull;
+  _queuedFull = -1;
+  startFullRefresh(mode);
 }
-void fullRefresh(int mode) {
-  epd.Init(FULL); renderToBuffer(mode);
-  epd.DisplayPartBaseImage(_fb); _partialCount = 0;
+
+/* full refreshes are queued so a mode change during a running
+ * waveform is rendered with the latest state once the panel is free.
+ * queueFullRefresh() only records the mode; the next tickDisplay()
+ * (the display task) does the init, render and upload */
+void queueFullRefresh(int mode) { _queuedFull = mode; }
+void fullRefresh(int mode) { queueFullRefresh(mode); tickDisplay(); }
+void deepRefresh(int mode) { fullRefresh(mode); }
+
+/* returns false if the panel was busy and nothing was started */
+bool partialRefresh(int mode) {
+  if (!isDisplayReady()) return false;
+  uint32_t start = millis();
+  if (uploadFrame(mode, false) == 0) {   // nothing changed on screen
+    _framesSkipped++;
+    return true;
+  }
+  _framesIssued++;
+  epd.BeginRefresh(PART);
+  _refreshing   = true;
+  _refreshStart = start;
+  return true;
+}
+
+/* expected partialRefresh() -> panel showing the frame, in ms */
+uint16_t displayPartialMs() { return _partialMs; }
+
+/* call once per loop() with the time until the app expects its next
+ * frame (DISPLAY_NO_FRAME if none); sleeps the idle controller when
+ * that is beyond the horizon */
+void idleDisplay(uint32_t nextFrameInMs) {
+  if (_epdAsleep || !isDisplayReady()) return;
+  if (nextFrameInMs < EPD_SLEEP_HORIZON_MS) return;
+  epd.DeepSleep();
+  _epdAsleep   = true;
+  _asleepSince = millis();
+  _sleepCount++;
 }
-void partialRefresh(int mode) {
-  if (_partialCount >= PARTIAL_LIMIT) { fullRefresh(mode); return; }
-  epd.Init(PART); renderToBuffer(mode);
-  epd.DisplayPart(_fb); _partialCount++;
+
+/* total controller deep-sleep time, including a sleep in progress */
+uint32_t displayAsleepMs() {
+  return _asleepMs + (_epdAsleep ? millis() - _asleepSince : 0);
 }
-void sleepDisplay() { epd.Sleep(); }
+uint16_t displaySleepCount() { return _sleepCount; }
+
+/* partial frames sent to the panel / dropped as identical */
+uint32_t displayFramesIssued()  { return _framesIssued; }
+uint32_t displayFramesSkipped() { return _framesSkipped; }
 
 // ═══════════════════════════════════════════════════════════
 //  Drawing primitives
 // ═══════════════════════════════════════════════════════════
 
 void thickHLine(int x, int y, int w, int t, int col) {
-  for (int d = -t; d <= t; d++) paint.DrawHorizontalLine(x, y + d, w, col);
+  gfx.DrawFilledRectangle(x, y - t, x + w - 1, y + t, col);
 }
 
+/* 2t+1 px wide stroke with round caps */
 void thickLine(int x0, int y0, int x1, int y1, int t, int col) {
-  for (int d = -t; d <= t; d++) paint.DrawLine(x0, y0 + d, x1, y1 + d, col);
+  gfx.DrawThickLine(x0, y0, x1, y1, t, col);
 }
 
-// ── Night-mode aware drawing helpers ────────────────────────
-// These use FG()/BG() to auto-invert colors in night mode
+// ── Ink drawing helpers ─────────────────────────────────────
+// Strokes in the ink colour (B; white on the panel in night mode)
 
 void nThickHLine(int x, int y, int w, int t) {
-  thickHLine(x, y, w, t, FG());
+  thickHLine(x, y, w, t, B);
 }
 void nThickLine(int x0, int y0, int x1, int y1, int t) {
-  thickLine(x0, y0, x1, y1, t, FG());
+  thickLine(x0, y0, x1, y1, t, B);
 }
 
 // ═══════════════════════════════════════════════════════════
@@ -123,15 +646,15 @@ void nThickLine(int x0, int y0, int x1, int y1, int t) {
 
 /* standard open: outline→white→pupil→sparkle */
 void eyeOpen(int cx, int cy, int R, int pR, int8_t pox) {
-  paint.DrawFilledCircle(cx, cy, R, FG());
-  paint.DrawFilledCircle(cx, cy, R - 3, BG());
-  paint.DrawFilledCircle(cx + pox, cy + 2, pR, FG());
-  paint.DrawFilledCircle(cx + pox - pR/3, cy + 2 - pR/3, pR/3 + 1, BG());
+  gfx.DrawFilledCircle(cx, cy, R, B);
+  gfx.DrawFilledCircle(cx, cy, R - 3, W);
+  gfx.DrawFilledCircle(cx + pox, cy + 2, pR, B);
+  gfx.DrawFilledCircle(cx + pox - pR/3, cy + 2 - pR/3, pR/3 + 1, W);
 }
 
 /* blink: thin bar */
 void eyeBlink(int cx, int cy, int R) {
-  paint.DrawFilledRectangle(cx - R, cy - 2, cx + R, cy + 2, FG());
+  gfx.DrawFilledRectangle(cx - R, cy - 2, cx + R, cy + 2, B);
 }
 
 /* happy ^_^ */
@@ -143,43 +666,43 @@ void eyeHappy(int cx, int cy, int R) {
 /* cute  ⌒‿⌒  (happy arc + sparkle dot above) */
 void eyeCute(int cx, int cy, int R) {
   eyeHappy(cx, cy, R);
-  paint.DrawFilledCircle(cx - R/2, cy - R + 2, 2, FG());
-  paint.DrawFilledCircle(cx + R/2, cy - R + 2, 2, FG());
+  gfx.DrawFilledCircle(cx - R/2, cy - R + 2, 2, B);
+  gfx.DrawFilledCircle(cx + R/2, cy - R + 2, 2, B);
 }
 
 /* interested: bigger pupil, slightly wider */
 void eyeInterested(int cx, int cy, int R, int8_t pox) {
-  paint.DrawFilledCircle(cx, cy, R, FG());
-  paint.DrawFilledCircle(cx, cy, R - 3, BG());
+  gfx.DrawFilledCircle(cx, cy, R, B);
+  gfx.DrawFilledCircle(cx, cy, R - 3, W);
   int bigP = R * 2 / 3;
-  paint.DrawFilledCircle(cx + pox, cy + 1, bigP, FG());
-  paint.DrawFilledCircle(cx + pox - bigP/3, cy - bigP/4, bigP/3 + 1, BG());
+  gfx.DrawFilledCircle(cx + pox, cy + 1, bigP, B);
+  gfx.DrawFilledCircle(cx + pox - bigP/3, cy - bigP/4, bigP/3 + 1, W);
 }
 
 /* bored: half-lid, small pupil off-centre */
 void eyeBored(int cx, int cy, int R) {
-  paint.DrawFilledCircle(cx, cy, R, FG());
-  paint.DrawFilledCircle(cx, cy, R - 3, BG());
-  paint.DrawFilledRectangle(cx - R - 1, cy - R - 1, cx + R + 1, cy, BG());
+  gfx.DrawFilledCircle(cx, cy, R, B);
+  gfx.DrawFilledCircle(cx, cy, R - 3, W);
+  gfx.DrawFilledRectangle(cx - R - 1, cy - R - 1, cx + R + 1, cy, W);
   nThickHLine(cx - R, cy, R * 2, 1);
-  paint.DrawFilledCircle(cx + R/3, cy + R/4, R/4, FG());
+  gfx.DrawFilledCircle(cx + R/3, cy + R/4, R/4, B);
 }
 
 /* surprised  O_O: extra wide, tiny far-apart pupils */
 void eyeSurprised(int cx, int cy, int R) {
   int bigR = R + 4;
-  paint.DrawFilledCircle(cx, cy, bigR, FG());
-  paint.DrawFilledCircle(cx, cy, bigR - 3, BG());
-  paint.DrawFilledCircle(cx, cy, R/3, FG());
-  paint.DrawFilledCircle(cx - 2, cy - 2, 2, BG());
+  gfx.DrawFilledCircle(cx, cy, bigR, B);
+  gfx.DrawFilledCircle(cx, cy, bigR - 3, W);
+  gfx.DrawFilledCircle(cx, cy, R/3, B);
+  gfx.DrawFilledCircle(cx - 2, cy - 2, 2, W);
 }
 
 /* worried: slightly droopy, brow line angled down-inward */
 void eyeWorried(int cx, int cy, int R, bool isLeft) {
-  paint.DrawFilledCircle(cx, cy, R, FG());
-  paint.DrawFilledCircle(cx, cy, R - 3, BG());
-  paint.DrawFilledCircle(cx, cy + 2, R/3, FG());
-  paint.DrawFilledCircle(cx - 1, cy, 2, BG());
+  gfx.DrawFilledCircle(cx, cy, R, B);
+  gfx.DrawFilledCircle(cx, cy, R - 3, W);
+  gfx.DrawFilledCircle(cx, cy + 2, R/3, B);
+  gfx.DrawFilledCircle(cx - 1, cy, 2, W);
   if (isLeft)
     nThickLine(cx - R, cy - R - 4, cx + R/2, cy - R + 2, 1);
   else
@@ -196,27 +719,27 @@ void eyeAnnoyed(int cx, int cy, int R) {
 
 /* dizzy  @_@: spiral-like concentric rings */
 void eyeDizzy(int cx, int cy, int R) {
-  paint.DrawCircle(cx, cy, R, FG());
-  paint.DrawCircle(cx, cy, R * 2 / 3, FG());
-  paint.DrawCircle(cx, cy, R / 3, FG());
-  paint.DrawFilledCircle(cx, cy, 3, FG());
+  gfx.DrawCircle(cx, cy, R, B);
+  gfx.DrawCircle(cx, cy, R * 2 / 3, B);
+  gfx.DrawCircle(cx, cy, R / 3, B);
+  gfx.DrawFilledCircle(cx, cy, 3, B);
 }
 
 /* sad: droopy outline + small pupil low */
 void eyeSad(int cx, int cy, int R) {
-  paint.DrawFilledCircle(cx, cy, R, FG());
-  paint.DrawFilledCircle(cx, cy, R - 3, BG());
-  paint.DrawFilledRectangle(cx - R - 1, cy - R - 1, cx + R + 1, cy - R/2, BG());
+  gfx.DrawFilledCircle(cx, cy, R, B);
+  gfx.DrawFilledCircle(cx, cy, R - 3, W);
+  gfx.DrawFilledRectangle(cx - R - 1, cy - R - 1, cx + R + 1, cy - R/2, W);
   nThickLine(cx - R, cy - R/3, cx + R, cy - R/2, 1);
-  paint.DrawFilledCircle(cx, cy + R/4, R/4, FG());
-  paint.DrawFilledCircle(cx - 1, cy + R/4 - 2, 2, BG());
+  gfx.DrawFilledCircle(cx, cy + R/4, R/4, B);
+  gfx.DrawFilledCircle(cx - 1, cy + R/4 - 2, 2, W);
 }
 
 /* angry: V brows + sharp pupil */
 void eyeAngry(int cx, int cy, int R, bool isLeft) {
-  paint.DrawFilledCircle(cx, cy, R, FG());
-  paint.DrawFilledCircle(cx, cy, R - 3, BG());
-  paint.DrawFilledCircle(cx, cy + 2, R/3 + 1, FG());
+  gfx.DrawFilledCircle(cx, cy, R, B);
+  gfx.DrawFilledCircle(cx, cy, R - 3, W);
+  gfx.DrawFilledCircle(cx, cy + 2, R/3 + 1, B);
   if (isLeft)
     nThickLine(cx - R, cy - R + 6, cx + R/2, cy - R - 2, 2);
   else
@@ -225,10 +748,10 @@ void eyeAngry(int cx, int cy, int R, bool isLeft) {
 
 /* confused: one brow up, one down */
 void eyeConfused(int cx, int cy, int R, bool isLeft) {
-  paint.DrawFilledCircle(cx, cy, R, FG());
-  paint.DrawFilledCircle(cx, cy, R - 3, BG());
-  paint.DrawFilledCircle(cx, cy + 1, R/3, FG());
-  paint.DrawFilledCircle(cx - 1, cy - 1, 2, BG());
+  gfx.DrawFilledCircle(cx, cy, R, B);
+  gfx.DrawFilledCircle(cx, cy, R - 3, W);
+  gfx.DrawFilledCircle(cx, cy + 1, R/3, B);
+  gfx.DrawFilledCircle(cx - 1, cy - 1, 2, W);
   if (isLeft)
     nThickLine(cx - R, cy - R - 2, cx + R/2, cy - R + 4, 1);
   else
@@ -237,21 +760,21 @@ void eyeConfused(int cx, int cy, int R, bool isLeft) {
 
 /* focused: squinted half-circle */
 void eyeFocused(int cx, int cy, int R, int pR) {
-  paint.DrawFilledCircle(cx, cy, R, FG());
-  paint.DrawFilledCircle(cx, cy, R - 2, BG());
-  paint.DrawFilledRectangle(cx - R - 1, cy - R - 1, cx + R + 1, cy - R/3, BG());
+  gfx.DrawFilledCircle(cx, cy, R, B);
+  gfx.DrawFilledCircle(cx, cy, R - 2, W);
+  gfx.DrawFilledRectangle(cx - R - 1, cy - R - 1, cx + R + 1, cy - R/3, W);
   nThickHLine(cx - R, cy - R/3, R * 2, 1);
-  paint.DrawFilledCircle(cx, cy + 2, pR, FG());
-  paint.DrawFilledCircle(cx - pR/4, cy + 1 - pR/4, pR/4 + 1, BG());
+  gfx.DrawFilledCircle(cx, cy + 2, pR, B);
+  gfx.DrawFilledCircle(cx - pR/4, cy + 1 - pR/4, pR/4 + 1, W);
 }
 
 /* tired: heavy lids */
 void eyeTired(int cx, int cy, int R) {
-  paint.DrawFilledCircle(cx, cy, R, FG());
-  paint.DrawFilledCircle(cx, cy, R - 3, BG());
-  paint.DrawFilledRectangle(cx - R - 1, cy - R - 1, cx + R + 1, cy + R/6, BG());
+  gfx.DrawFilledCircle(cx, cy, R, B);
+  gfx.DrawFilledCircle(cx, cy, R - 3, W);
+  gfx.DrawFilledRectangle(cx - R - 1, cy - R - 1, cx + R + 1, cy + R/6, W);
   nThickHLine(cx - R, cy + R/6, R * 2, 1);
-  paint.DrawFilledCircle(cx, cy + R/3, R/4, FG());
+  gfx.DrawFilledCircle(cx, cy + R/3, R/4, B);
 }
 
 /* asleep: gentle closed curves */
@@ -269,7 +792,6 @@ void drawEyePair(int lx, int rx, int ey, int R, int pR) {
   int8_t  pox   = getPetEyeOffsetX();
   uint8_t blink = getPetBlinkLevel();
   bool    spec  = isPetSpecialPhase();
-  int fg = FG();
 
   /* always blink on phase 3, regardless of mood */
   if (blink == 2) {
@@ -301,10 +823,10 @@ void drawEyePair(int lx, int rx, int ey, int R, int pR) {
     case MOOD_CUTE:
       eyeOpen(lx, ey, R, pR, pox); eyeOpen(rx, ey, R, pR, pox);
       /* blush dots under eyes */
-      paint.DrawFilledCircle(lx - R/2, ey + R + 4, 3, fg);
-      paint.DrawFilledCircle(lx + R/2, ey + R + 4, 3, fg);
-      paint.DrawFilledCircle(rx - R/2, ey + R + 4, 3, fg);
-      paint.DrawFilledCircle(rx + R/2, ey + R + 4, 3, fg);
+      gfx.DrawFilledCircle(lx - R/2, ey + R + 4, 3, B);
+      gfx.DrawFilledCircle(lx + R/2, ey + R + 4, 3, B);
+      gfx.DrawFilledCircle(rx - R/2, ey + R + 4, 3, B);
+      gfx.DrawFilledCircle(rx + R/2, ey + R + 4, 3, B);
       break;
     case MOOD_INTERESTED:
       eyeInterested(lx, ey, R, pox); eyeInterested(rx, ey, R, pox); break;
@@ -340,53 +862,57 @@ void drawEyePair(int lx, int rx, int ey, int R, int pR) {
 //  Drawn near the eyes to express emotion
 // ═══════════════════════════════════════════════════════════
 
-/* small heart shape at (cx, cy) */
+/* sprite ink in colour col centred on (cx, cy); the bitmap is its own
+ * mask, so the background around the shape is left alone */
+void drawSprite(const Sprite& spr, int cx, int cy, int col) {
+  gfx.DrawBitmap(cx - spr.cx, cy - spr.cy, spr.bits, spr.w, spr.h,
+                   col ? ROP_COPY : ROP_INVERT, spr.bits, spr.bits_rot, spr.bits_rot);
+}
+
+static const Sprite* const HEARTS[]   = { &SPR_HEART_3, &SPR_HEART_4, &SPR_HEART_5 };
+static const Sprite* const ANGERS[]   = { &SPR_ANGER_4, &SPR_ANGER_5, &SPR_ANGER_6 };
+static const Sprite* const SPARKLES[] = { &SPR_SPARKLE_2, &SPR_SPARKLE_3,
+                                          &SPR_SPARKLE_4, &SPR_SPARKLE_5 };
+
+/* small heart shape at (cx, cy), s = 3..5 */
 void drawHeart(int cx, int cy, int s) {
-  int fg = FG();
-  paint.DrawFilledCircle(cx - s, cy, s, fg);
-  paint.DrawFilledCircle(cx + s, cy, s, fg);
-  for (int row = 0; row <= s * 2; row++) {
-    int hw = s * 2 - row;
-    if (hw < 0) hw = 0;
-    paint.DrawHorizontalLine(cx - hw, cy + row, hw * 2 + 1, fg);
-  }
+  if (s < 3) s = 3;
+  if (s > 5) s = 5;
+  drawSprite(*HEARTS[s - 3], cx, cy, B);
 }
 
-/* manga anger cross ╳ at (cx, cy) */
+/* manga anger cross ╳ at (cx, cy), s = 4..6 */
 void drawAngerMark(int cx, int cy, int s) {
-  nThickLine(cx - s, cy - s, cx + s, cy + s, 1);
-  nThickLine(cx + s, cy - s, cx - s, cy + s, 1);
+  if (s < 4) s = 4;
+  if (s > 6) s = 6;
+  drawSprite(*ANGERS[s - 4], cx, cy, B);
 }
 
 /* sweat drop at (cx, cy) */
 void drawSweatDrop(int cx, int cy, int s) {
-  int fg = FG();
-  paint.DrawFilledCircle(cx, cy + s, s, fg);
-  paint.DrawLine(cx, cy - s, cx - s, cy + s, fg);
-  paint.DrawLine(cx, cy - s, cx + s, cy + s, fg);
+  gfx.DrawFilledCircle(cx, cy + s, s, B);
+  gfx.DrawLine(cx, cy - s, cx - s, cy + s, B);
+  gfx.DrawLine(cx, cy - s, cx + s, cy + s, B);
 }
 
-/* sparkle ✦ four-pointed star */
+/* sparkle ✦ four-pointed star, s = 2..5 */
 void drawSparkle(int cx, int cy, int s) {
-  int fg = FG();
-  paint.DrawLine(cx, cy - s, cx, cy + s, fg);
-  paint.DrawLine(cx - s, cy, cx + s, cy, fg);
-  paint.DrawFilledCircle(cx, cy, s/3, fg);
+  if (s < 2) s = 2;
+  if (s > 5) s = 5;
+  drawSprite(*SPARKLES[s - 2], cx, cy, B);
 }
 
 /* spiral @ */
 void drawSpiral(int cx, int cy, int R) {
-  int fg = FG();
-  paint.DrawCircle(cx, cy, R, fg);
-  paint.DrawCircle(cx, cy, R * 2/3, fg);
-  paint.DrawCircle(cx + 2, cy - 1, R/3, fg);
+  gfx.DrawCircle(cx, cy, R, B);
+  gfx.DrawCircle(cx, cy, R * 2/3, B);
+  gfx.DrawCircle(cx + 2, cy - 1, R/3, B);
 }
 
 void drawMoodSymbol(int rx, int ey, int R) {
   PetMood mood = getPetMood();
   int sx = rx + R + 8;
   int sy = ey - R/2;
-  int fg = FG();
 
   switch (mood) {
     case MOOD_HAPPY:
@@ -396,10 +922,10 @@ void drawMoodSymbol(int rx, int ey, int R) {
       drawSparkle(sx + 14, sy + 2, 4);
       break;
     case MOOD_SURPRISED:
-      paint.DrawFilledRectangle(sx, sy - 6, sx + 3, sy + 6, fg);
-      paint.DrawFilledCircle(sx + 1, sy + 10, 2, fg);
-      paint.DrawFilledRectangle(sx + 8, sy - 6, sx + 11, sy + 6, fg);
-      paint.DrawFilledCircle(sx + 9, sy + 10, 2, fg);
+      gfx.DrawFilledRectangle(sx, sy - 6, sx + 3, sy + 6, B);
+      gfx.DrawFilledCircle(sx + 1, sy + 10, 2, B);
+      gfx.DrawFilledRectangle(sx + 8, sy - 6, sx + 11, sy + 6, B);
+      gfx.DrawFilledCircle(sx + 9, sy + 10, 2, B);
       break;
     case MOOD_WORRIED:
       drawSweatDrop(sx + 4, sy, 4);
@@ -417,13 +943,13 @@ void drawMoodSymbol(int rx, int ey, int R) {
       drawSweatDrop(rx + R/2, ey + R + 4, 3);
       break;
     case MOOD_CONFUSED:
-      paint.DrawCircle(sx + 4, sy - 2, 5, fg);
-      paint.DrawFilledRectangle(sx + 7, sy - 2, sx + 9, sy + 6, fg);
-      paint.DrawFilledCircle(sx + 8, sy + 10, 2, fg);
+      gfx.DrawCircle(sx + 4, sy - 2, 5, B);
+      gfx.DrawFilledRectangle(sx + 7, sy - 2, sx + 9, sy + 6, B);
+      gfx.DrawFilledCircle(sx + 8, sy + 10, 2, B);
       break;
     case MOOD_TIRED:
-      paint.DrawStringAt(sx, sy - 4, "z", &Font8, fg);
-      paint.DrawStringAt(sx + 8, sy - 10, "z", &Font12, fg);
+      gfx.DrawStringAt(sx, sy - 4, "z", &Font8, B);
+      gfx.DrawStringAt(sx + 8, sy - 10, "z", &Font12, B);
       break;
     default:
       break;
@@ -440,11 +966,9 @@ void drawPetFace() {
 
   if (_nightMode) {
     /* ── Night sky decorations ───────────────────────── */
-    int fg = FG();
 
     /* crescent moon (top-left) */
-    paint.DrawFilledCircle(30, 22, 14, fg);
-    paint.DrawFilledCircle(38, 16, 12, BG());  // shadow bite
+    drawSprite(SPR_MOON, 30, 22, B);
 
     /* scattered stars (small sparkles) */
     drawSparkle(8,   8,   3);
@@ -456,11 +980,11 @@ void drawPetFace() {
     drawSparkle(240, 100, 2);
 
     /* tiny star dots */
-    paint.DrawFilledCircle(70,  14, 1, fg);
-    paint.DrawFilledCircle(150,  8, 1, fg);
-    paint.DrawFilledCircle(180, 15, 1, fg);
-    paint.DrawFilledCircle(45, 108, 1, fg);
-    paint.DrawFilledCircle(200, 105, 1, fg);
+    gfx.DrawFilledCircle(70,  14, 1, B);
+    gfx.DrawFilledCircle(150,  8, 1, B);
+    gfx.DrawFilledCircle(180, 15, 1, B);
+    gfx.DrawFilledCircle(45, 108, 1, B);
+    gfx.DrawFilledCircle(200, 105, 1, B);
   }
 
   drawEyePair(LX, RX, EY, R, PR);
@@ -474,21 +998,17 @@ void drawPetFace() {
 void drawSleepFace() {
   const int LX = 78, RX = 172, EY = 52;
   const int R = 28;
-  int fg = FG();
 
   eyeAsleep(LX, EY, R);
   eyeAsleep(RX, EY, R);
 
-  /* floating zzz */
-  if (millis() - _sleepTimer > 800) {
-    _sleepTimer = millis();
-    _sleepFrame = (_sleepFrame + 1) % 3;
-  }
-  int bx = 188 + _sleepFrame * 5;
-  int by = 36  - _sleepFrame * 3;
-  paint.DrawStringAt(bx,      by,      "z", &Font12, fg);
-  paint.DrawStringAt(bx + 12, by - 10, "z", &Font16, fg);
-  paint.DrawStringAt(bx + 26, by - 22, "z", &Font20, fg);
+  /* floating zzz, stepped by the asleep clip */
+  uint8_t zf = getPetZzzFrame();
+  int bx = 188 + zf * 5;
+  int by = 36  - zf * 3;
+  gfx.DrawStringAt(bx,      by,      "z", &Font12, B);
+  gfx.DrawStringAt(bx + 12, by - 10, "z", &Font16, B);
+  gfx.DrawStringAt(bx + 26, by - 22, "z", &Font20, B);
 
   /* night mode: add stars around sleeping face */
   if (_nightMode) {
@@ -496,8 +1016,8 @@ void drawSleepFace() {
     drawSparkle(50,   8, 2);
     drawSparkle(230, 12, 3);
     drawSparkle(15, 100, 2);
-    paint.DrawFilledCircle(100, 10, 1, fg);
-    paint.DrawFilledCircle(200,  6, 1, fg);
+    gfx.DrawFilledCircle(100, 10, 1, B);
+    gfx.DrawFilledCircle(200,  6, 1, B);
   }
 }
 
@@ -506,50 +1026,48 @@ void drawSleepFace() {
 // ═══════════════════════════════════════════════════════════
 
 void drawTempCalPortrait() {
-  updateCalendarReadings();
-  int fg = FG();
   int tempI = isnan(_tempC) ? 0 : (int)_tempC;
   int tempF = isnan(_tempC) ? 0 : (int)(fabs(_tempC - tempI) * 10.0f);
   int hum = isnan(_humPct) ? 0 : (int)(_humPct + 0.5f);
   if (hum < 0) hum = 0;
   if (hum > 100) hum = 100;
 
-  paint.DrawStringAt(10, 8,  _dayBuf, &Font12, fg);
-  paint.DrawStringAt(10, 26, _dateBuf, &Font12, fg);
-  paint.DrawHorizontalLine(4, 44, 114, fg);
+  gfx.DrawStringAt(10, 8,  _dayBuf, &Font12, B);
+  gfx.DrawStringAt(10, 26, _dateBuf, &Font12, B);
+  gfx.DrawHorizontalLine(4, 44, 114, B);
 
-  paint.DrawStringAt(10, 54, _timeBuf, &Font24, fg);
-  paint.DrawHorizontalLine(4, 88, 114, fg);
+  gfx.DrawStringAt(10, 54, _timeBuf, &Font24, B);
+  gfx.DrawHorizontalLine(4, 88, 114, B);
 
-  paint.DrawStringAt(6, 96, "Temperature", &Font12, fg);
+  gfx.DrawStringAt(6, 96, "Temperature", &Font12, B);
   {
     char buf[16];
     snprintf(buf, sizeof(buf), "%d.%d", tempI, tempF);
-    paint.DrawStringAt(6, 114, buf, &Font24, fg);
+    gfx.DrawStringAt(6, 114, buf, &Font24, B);
     int tx = 6 + 17 * (int)strlen(buf);
-    paint.DrawCircle(tx + 3, 116, 2, fg);
-    paint.DrawStringAt(tx + 8, 114, "C", &Font24, fg);
+    gfx.DrawCircle(tx + 3, 116, 2, B);
+    gfx.DrawStringAt(tx + 8, 114, "C", &Font24, B);
   }
 
   int barW = 100;
-  paint.DrawRectangle(6, 146, 6 + barW, 158, fg);
+  gfx.DrawRectangle(6, 146, 6 + barW, 158, B);
   int fill = (int)(barW * (tempI + tempF / 10.0f) / 45.0f);
   if (fill > barW) fill = barW;
-  if (fill > 0) paint.DrawFilledRectangle(6, 146, 6 + fill, 158, fg);
+  if (fill > 0) gfx.DrawFilledRectangle(6, 146, 6 + fill, 158, B);
 
-  paint.DrawHorizontalLine(4, 168, 114, fg);
-  paint.DrawStringAt(6, 176, "Humidity", &Font12, fg);
+  gfx.DrawHorizontalLine(4, 168, 114, B);
+  gfx.DrawStringAt(6, 176, "Humidity", &Font12, B);
   {
     char buf[8];
     snprintf(buf, sizeof(buf), "%d%%", hum);
-    paint.DrawStringAt(6, 194, buf, &Font24, fg);
+    gfx.DrawStringAt(6, 194, buf, &Font24, B);
   }
 
-  paint.DrawRectangle(6, 224, 6 + barW, 236, fg);
+  gfx.DrawRectangle(6, 224, 6 + barW, 236, B);
   int hfill = barW * hum / 100;
-  if (hfill > 0) paint.DrawFilledRectangle(6, 224, 6 + hfill, 236, fg);
+  if (hfill > 0) gfx.DrawFilledRectangle(6, 224, 6 + hfill, 236, B);
 
-  paint.DrawStringAt(20, 244, "UniBuddy", &Font8, fg);
+  gfx.DrawStringAt(20, 244, "UniBuddy", &Font8, B);
 }
 
 // ═══════════════════════════════════════════════════════════
@@ -569,10 +1087,9 @@ void drawFocusScreen() {
   const int EL = 78, ER = 172, EY = 26;
   const int R = 22, PR = 9;
   uint8_t blink = getPetBlinkLevel();
-  int fg = FG(), bg = BG();
 
   static const int8_t _drift[] = {0, 1, 2, 1, 0, -1, -2, -1};
-  int8_t pdx = _drift[(millis() / 1000) % 8];
+  int8_t pdx = _drift[_frameSecs % 8];     // steps with the digits
 
   if (blink == 2) {
     eyeBlink(EL, EY, R);
@@ -581,36 +1098,36 @@ void drawFocusScreen() {
     int exs[2] = {EL, ER};
     for (int i = 0; i < 2; i++) {
       int cx = exs[i];
-      paint.DrawFilledCircle(cx, EY, R, fg);
-      paint.DrawFilledCircle(cx, EY, R - 2, bg);
-      paint.DrawFilledRectangle(cx - R - 1, EY - R - 1, cx + R + 1, EY - R/3, bg);
+      gfx.DrawFilledCircle(cx, EY, R, B);
+      gfx.DrawFilledCircle(cx, EY, R - 2, W);
+      gfx.DrawFilledRectangle(cx - R - 1, EY - R - 1, cx + R + 1, EY - R/3, W);
       nThickHLine(cx - R, EY - R/3, R * 2, 1);
-      paint.DrawFilledCircle(cx + pdx, EY + 2, PR, fg);
-      paint.DrawFilledCircle(cx + pdx - PR/4, EY + 1 - PR/4, PR/4 + 1, bg);
+      gfx.DrawFilledCircle(cx + pdx, EY + 2, PR, B);
+      gfx.DrawFilledCircle(cx + pdx - PR/4, EY + 1 - PR/4, PR/4 + 1, W);
     }
   }
 
   /* --- progress bar --- */
-  uint32_t sLeft = pomodoroSecondsLeft();
+  uint32_t sLeft = _frameSecs;
   float progress = 1.0f - (float)sLeft / (POMODORO_DURATION / 1000.0f);
   if (progress < 0) progress = 0;
   if (progress > 1) progress = 1;
   int barX = 16, barY = 54, barW = 218, barH = 12;
-  paint.DrawRectangle(barX, barY, barX + barW, barY + barH, fg);
+  gfx.DrawRectangle(barX, barY, barX + barW, barY + barH, B);
   int fw = (int)(barW * progress);
   if (fw > 0)
-    paint.DrawFilledRectangle(barX + 1, barY + 1,
-                              barX + fw, barY + barH - 1, fg);
+    gfx.DrawFilledRectangle(barX + 1, barY + 1,
+                              barX + fw, barY + barH - 1, B);
 
   /* --- time --- */
   int mn = sLeft / 60, sc = sLeft % 60;
   char timeBuf[8];
   snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d", mn, sc);
-  paint.DrawStringAt(84, 72, timeBuf, &Font24, fg);
+  gfx.DrawStringAt(84, 72, timeBuf, &Font24, B);
 
   /* --- paused indicator --- */
   if (isPomPaused()) {
-    paint.DrawStringAt(80, 94, "|| PAUSED", &Font12, fg);
+    gfx.DrawStringAt(80, 94, "|| PAUSED", &Font12, B);
   }
 
   /* --- bottom row --- */
@@ -619,16 +1136,16 @@ void drawFocusScreen() {
   {
     char sb[16];
     snprintf(sb, sizeof(sb), "Session %d", sess + 1);
-    paint.DrawStringAt(6, by, sb, &Font12, fg);
+    gfx.DrawStringAt(6, by, sb, &Font12, B);
   }
   for (int i = 0; i < 4; i++) {
     int dotX = 110 + i * 14;
     if ((int)i < (int)(sess % 4))
-      paint.DrawFilledCircle(dotX, by + 6, 4, fg);
+      gfx.DrawFilledCircle(dotX, by + 6, 4, B);
     else
-      paint.DrawCircle(dotX, by + 6, 4, fg);
+      gfx.DrawCircle(dotX, by + 6, 4, B);
   }
-  paint.DrawStringAt(194, by, "FOCUS", &Font12, fg);
+  gfx.DrawStringAt(194, by, "FOCUS", &Font12, B);
 }
 
 // ═══════════════════════════════════════════════════════════
@@ -636,20 +1153,19 @@ void drawFocusScreen() {
 // ═══════════════════════════════════════════════════════════
 
 void drawBreakScreen() {
-  int fg = FG();
-  paint.DrawStringAt(52, 4, "BREAK TIME", &Font20, fg);
-  paint.DrawHorizontalLine(4, 28, 242, fg);
+  gfx.DrawStringAt(52, 4, "BREAK TIME", &Font20, B);
+  gfx.DrawHorizontalLine(4, 28, 242, B);
 
-  uint32_t sLeft = breakSecondsLeft();
+  uint32_t sLeft = _frameSecs;
   int mn = sLeft / 60, sc = sLeft % 60;
   char timeBuf[8];
   snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d", mn, sc);
-  paint.DrawStringAt(70, 36, timeBuf, &Font24, fg);
+  gfx.DrawStringAt(70, 36, timeBuf, &Font24, B);
 
   {
     char buf[24];
     snprintf(buf, sizeof(buf), "Cycle %d done!", getCompletedCycleCount());
-    paint.DrawStringAt(60, 72, buf, &Font12, fg);
+    gfx.DrawStringAt(60, 72, buf, &Font12, B);
   }
 
   eyeHappy(80, 100, 16);
@@ -661,8 +1177,14 @@ void drawBreakScreen() {
 // ═══════════════════════════════════════════════════════════
 
 void renderToBuffer(int mode) {
-  paint.Clear(BG());
+  paint.Clear(W);
+  drawScreen(mode);
+}
+
+/* run the drawer for `mode` through gfx, without clearing */
+void drawScreen(int mode) {
   switch (mode) {
+    case SCREEN_SPLASH:   drawSplash();        break;
     case MODE_PET:        drawPetFace();       break;
     case MODE_SLEEP:      drawSleepFace();     break;
     case MODE_TEMPTIME_L:
@@ -28,8 +28,90 @@
 #
 ******************************************************************************/
 #include <stdlib.h>
+#include <avr/pgmspace.h>
 #include "epd2in13_V4.h"
 
+/******************************************************************************
+Waveform tables for the LUT register (0x32), 159 bytes:
+	[0..59]    VS phase voltages, LUT0..LUT4 x 12
+	[60..143]  TP/RP timing, 12 groups x 7
+	[144..152] FR frame rate / XON gate scan
+	[153]      EOPT (0x3F)   [154] VGH (0x03)
+	[155..157] VSH1, VSH2, VSL (0x04)   [158] VCOM (0x2C)
+******************************************************************************/
+
+/* short-phase: one 10-frame drive, used for pet eye animation */
+const unsigned char WF_ANIM_2IN13_V4[WF_LUT_SIZE] PROGMEM = {
+    0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0A,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x22,0x22,0x22,0x22,0x22,0x22,0x00,0x00,0x00,
+    0x22,0x17,0x41,0x00,0x32,0x36,
+};
+
+/* balanced: 20-frame drive plus two settle frames, used for timer digits */
+const unsigned char WF_TIMER_2IN13_V4[WF_LUT_SIZE] PROGMEM = {
+    0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x14,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x22,0x22,0x22,0x22,0x22,0x22,0x00,0x00,0x00,
+    0x22,0x17,0x41,0x00,0x32,0x36,
+};
+
+/* deep clean: real transitions (black->white, white->black) are shaken
+ * through both rails; LUT0/LUT3 (black->black, white->white) stay idle,
+ * so only pixels whose old RAM differs from the new image are driven.
+ * The caller picks which ones by writing the inverted image to 0x26. */
+const unsigned char WF_CLEAN_2IN13_V4[WF_LUT_SIZE] PROGMEM = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x40,0x4A,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x80,0x4A,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0F,0x00,0x00,0x0F,0x00,0x00,0x02,
+    0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x22,0x22,0x22,0x22,0x22,0x22,0x00,0x00,0x00,
+    0x22,0x17,0x41,0x00,0x32,0x36,
+};
+
 Epd::~Epd()
 {
 };
@@ -48,6 +130,10 @@ Epd::Epd()
     height = EPD_HEIGHT;
     bufwidth = 128/8;  //16
     bufheight = 63;
+    mode = -1;
+    lut = NULL;
+    fast_temp = 100;
+    if_ready = false;
 };
 
 /******************************************************************************
@@ -72,6 +158,31 @@ void Epd::SendData(unsigned char data)
     SpiTransfer(data);
 }
 
+/******************************************************************************
+function :	send a block of data in one transfer (DC set once, CS held)
+parameter:
+    data : Data bytes
+    len  : Number of bytes
+    mask : XORed into every byte (0xFF = inverted)
+******************************************************************************/
+void Epd::SendDataBlock(const unsigned char* data, unsigned int len, unsigned char mask)
+{
+    DigitalWrite(dc_pin, HIGH);
+    SpiTransfer(data, len, mask);
+}
+
+/******************************************************************************
+function :	send the same data byte len times in one transfer
+parameter:
+    data : Fill byte
+    len  : Number of bytes
+******************************************************************************/
+void Epd::SendDataRepeat(unsigned char data, unsigned int len)
+{
+    DigitalWrite(dc_pin, HIGH);
+    SpiTransferRepeat(data, len);
+}
+
 /******************************************************************************
 function :	Wait until the busy_pin goes LOW
 parameter:
@@ -85,6 +196,33 @@ void Epd::WaitUntilIdle(void)
     }
 }
 
+/******************************************************************************
+function :	Start a display refresh and return without waiting for BUSY.
+            Poll IsRefreshDone() before sending anything else.
+parameter:
+	Mode : FULL, FAST or PART waveform
+******************************************************************************/
+void Epd::BeginRefresh(char Mode)
+{
+    SendCommand(0x22);
+    if (Mode == FAST)
+        SendData(0xC7);
+    else if (Mode == PART)
+        SendData(this->lut != NULL ? 0xCF : 0xff);   // 0xff reloads the OTP LUT
+    else
+        SendData(0xf7);
+    SendCommand(0x20);
+}
+
+/******************************************************************************
+function :	Non-blocking BUSY check
+parameter:
+******************************************************************************/
+bool Epd::IsRefreshDone(void)
+{
+    return DigitalRead(busy_pin) == 0;      //LOW: idle, HIGH: busy
+}
+
 /******************************************************************************
 function :	Setting the display window
 parameter:
@@ -124,6 +262,58 @@ void Epd::SetCursor(unsigned char Xstart, unsigned char Ystart)
 
 
 
+/******************************************************************************
+function :	Write the 153-byte waveform (VS, TP/RP, FR, XON) to the LUT register
+parameter:
+	lut : Waveform table, see WF_LUT_SIZE
+******************************************************************************/
+void Epd::Lut(const unsigned char *lut)
+{
+    SendCommand(0x32);
+    SendDataBlock(lut, 153);
+    WaitUntilIdle();
+}
+
+/******************************************************************************
+function :	Load a full custom waveform (LUT plus gate/source/VCOM voltages)
+            for the following partial refreshes. Skipped when the same table
+            is already loaded in this session.
+parameter:
+	lut : WF_*_2IN13_V4 table (WF_LUT_SIZE bytes, PROGMEM)
+******************************************************************************/
+void Epd::SetLut(const unsigned char *lut)
+{
+    if (lut == this->lut) {
+        return;
+    }
+
+    Lut(lut);
+    SendCommand(0x3F);  // EOPT
+    SendData(pgm_read_byte(&lut[153]));
+    SendCommand(0x03);  // gate voltage
+    SendData(pgm_read_byte(&lut[154]));
+    SendCommand(0x04);  // source voltage
+    SendData(pgm_read_byte(&lut[155]));
+    SendData(pgm_read_byte(&lut[156]));
+    SendData(pgm_read_byte(&lut[157]));
+    SendCommand(0x2C);  // VCOM
+    SendData(pgm_read_byte(&lut[158]));
+
+    SendCommand(0x37);  // display option: enable RAM ping-pong for mode 2
+    SendData(0x00);
+    SendData(0x00);
+    SendData(0x00);
+    SendData(0x00);
+    SendData(0x00);
+    SendData(0x40);
+    SendData(0x00);
+    SendData(0x00);
+    SendData(0x00);
+    SendData(0x00);
+
+    this->lut = lut;
+}
+
 /******************************************************************************
 function :	Initialize the e-Paper register
 parameter:
@@ -131,9 +321,17 @@ parameter:
 ******************************************************************************/
 int Epd::Init(char Mode)
 {
+    /* partial session already open: registers and RAM are still valid */
+    if (Mode == PART && this->mode == PART) {
+        return 0;
+    }
+
     /* this calls the peripheral hardware interface, see epdif */
-    if (IfInit() != 0) {
-        return -1;
+    if (!if_ready) {
+        if (IfInit() != 0) {
+            return -1;
+        }
+        if_ready = true;
     }
     
     Reset();
@@ -186,7 +384,7 @@ int Epd::Init(char Mode)
         WaitUntilIdle();
 
 		SendCommand(0x1A); //  Write to temperature register
-		SendData(0x64);
+		SendData(fast_temp & 0xFF);
 		SendData(0x00);	
 
         SendCommand(0x22); //  Load temperature value
@@ -216,9 +414,27 @@ int Epd::Init(char Mode)
         return -1;
     }
 
+    this->mode = Mode;
     return 0;
 }
 
+/******************************************************************************
+function :	FAST init with a chosen temperature. The OTP table is picked by
+            the value in the temperature register; higher values select
+            shorter waveforms. Init(FAST) forces 100 °C (the shortest).
+parameter:
+	temperature : Value for register 0x1A in °C (clamped to 0..100)
+******************************************************************************/
+int Epd::InitFast(int temperature)
+{
+    if (temperature < 0) temperature = 0;
+    if (temperature > 100) temperature = 100;
+    this->fast_temp = temperature;
+    int ret = Init(FAST);
+    this->fast_temp = 100;
+    return ret;
+}
+
 /******************************************************************************
 function :	Software reset
 parameter:
@@ -232,6 +448,8 @@ void Epd::Reset(void)
     DigitalWrite(reset_pin, HIGH);
     DelayMs(20);
     this->count = 0; 
+    this->mode = -1;
+    this->lut = NULL;
 }
 
 /******************************************************************************
@@ -244,11 +462,7 @@ void Epd::Clear(void)
     w = (EPD_WIDTH % 8 == 0)? (EPD_WIDTH / 8 ): (EPD_WIDTH / 8 + 1);
     h = EPD_HEIGHT;
     SendCommand(0x24);
-    for (int j = 0; j < h; j++) {
-        for (int i = 0; i < w; i++) {
-            SendData(0xff);
-        }
-    }
+    SendDataRepeat(0xff, w * h);
 
     //DISPLAY REFRESH
     SendCommand(0x22);
@@ -269,11 +483,7 @@ void Epd::Display(const unsigned char* frame_buffer)
 
     if (frame_buffer != NULL) {
         SendCommand(0x24);
-        for (int j = 0; j < h; j++) {
-            for (int i = 0; i < w; i++) {
-                SendData(pgm_read_byte(&frame_buffer[i + j * w]));
-            }
-        }
+        SendDataBlock(frame_buffer, w * h);
     }
 
     //DISPLAY REFRESH
@@ -290,9 +500,7 @@ void Epd::Display1(const unsigned char* frame_buffer) {
     }else if(this->count > 0 && this->count < 4 ){
         this->count++;
     }
-    for(int i = 0; i < this->bufwidth * this->bufheight; i++){
-            SendData(frame_buffer[i]);
-    }
+    SendDataBlock(frame_buffer, this->bufwidth * this->bufheight);
     if(this->count == 4){
         SendCommand(0x22);
         SendData(0xf7);
@@ -314,11 +522,7 @@ void Epd::Display_Fast(const unsigned char* frame_buffer)
 
     if (frame_buffer != NULL) {
         SendCommand(0x24);
-        for (int j = 0; j < h; j++) {
-            for (int i = 0; i < w; i++) {
-                SendData(pgm_read_byte(&frame_buffer[i + j * w]));
-            }
-        }
+        SendDataBlock(frame_buffer, w * h);
     }
 
     //DISPLAY REFRESH
@@ -338,32 +542,34 @@ parameter:
 ******************************************************************************/
 void Epd::DisplayPartBaseImage(const unsigned char* frame_buffer)
 {
-    int w = (EPD_WIDTH % 8 == 0)? (EPD_WIDTH / 8 ): (EPD_WIDTH / 8 + 1);
-    int h = EPD_HEIGHT;
-
     if (frame_buffer != NULL) {
-        SendCommand(0x24);
-        for (int j = 0; j < h; j++) {
-            for (int i = 0; i < w; i++) {
-                SendData(pgm_read_byte(&frame_buffer[i + j * w]));
-            }
-        }
-
-        SendCommand(0x26);
-        for (int j = 0; j < h; j++) {
-            for (int i = 0; i < w; i++) {
-                SendData(pgm_read_byte(&frame_buffer[i + j * w]));
-            }
-        }
+        WriteBaseImage(frame_buffer);
     }
 
     //DISPLAY REFRESH
-    SendCommand(0x22);
-    SendData(0xf7);
-    SendCommand(0x20);
+    BeginRefresh(FULL);
     WaitUntilIdle();
 }
 
+/******************************************************************************
+function :	Upload a base image into both RAMs (0x24 new, 0x26 old) without
+            refreshing
+parameter:
+	frame_buffer : Image data
+	mask : XORed into every byte (0xFF = inverted)
+******************************************************************************/
+void Epd::WriteBaseImage(const unsigned char* frame_buffer, unsigned char mask)
+{
+    int w = (EPD_WIDTH % 8 == 0)? (EPD_WIDTH / 8 ): (EPD_WIDTH / 8 + 1);
+    int h = EPD_HEIGHT;
+
+    SendCommand(0x24);
+    SendDataBlock(frame_buffer, w * h, mask);
+
+    SendCommand(0x26);
+    SendDataBlock(frame_buffer, w * h, mask);
+}
+
 /******************************************************************************
 function :	Sends the image buffer in RAM to e-Paper and partial refresh
 parameter:
@@ -375,18 +581,125 @@ void Epd::DisplayPart(const unsigned char* frame_buffer)
     int h = EPD_HEIGHT;
 
     if (frame_buffer != NULL) {
+        /* a windowed update may have narrowed the RAM window */
+        SetWindows(0, 0, EPD_WIDTH-1, EPD_HEIGHT-1);
+        SetCursor(0, 0);
         SendCommand(0x24);
-        for (int j = 0; j < h; j++) {
-            for (int i = 0; i < w; i++) {
-                SendData(pgm_read_byte(&frame_buffer[i + j * w]));
-            }
+        SendDataBlock(frame_buffer, w * h);
+    }
+
+    TurnOnDisplayPart();
+}
+
+/******************************************************************************
+function :	Upload one byte-aligned window of the frame buffer to RAM 0x24
+            without refreshing. The rest of the controller RAM keeps the
+            previously uploaded image.
+parameter:
+	x : Window start column in pixels (multiple of 8)
+	y : Window start row
+	w : Window width in pixels (multiple of 8)
+	h : Window height in rows
+	frame_buffer : Full-size image data (16 bytes per row)
+	mask : XORed into every byte (0xFF = inverted)
+******************************************************************************/
+void Epd::WritePartWindow(int x, int y, int w, int h, const unsigned char* frame_buffer, unsigned char mask)
+{
+    int stride = (EPD_WIDTH % 8 == 0)? (EPD_WIDTH / 8 ): (EPD_WIDTH / 8 + 1);
+    int xb = x / 8;
+    int wb = (w + 7) / 8;
+
+    SetWindows(x, y, x + w - 1, y + h - 1);
+    SetCursor(xb, y);
+
+    SendCommand(0x24);
+    for (int j = y; j < y + h; j++) {
+        SendDataBlock(&frame_buffer[xb + j * stride], wb, mask);
+    }
+}
+
+/******************************************************************************
+function :	Upload a strip of full-width rows into one RAM without refreshing
+parameter:
+	ram  : 0x24 (new) or 0x26 (old)
+	y, h : First panel row and row count
+	rows : Strip data, h rows of the panel stride, starting at row y
+	mask : XORed into every byte (0xFF = inverted)
+******************************************************************************/
+void Epd::WriteRamRows(unsigned char ram, int y, int h, const unsigned char* rows, unsigned char mask)
+{
+    int stride = (EPD_WIDTH % 8 == 0)? (EPD_WIDTH / 8 ): (EPD_WIDTH / 8 + 1);
+
+    SetWindows(0, y, EPD_WIDTH-1, y + h - 1);
+    SetCursor(0, y);
+
+    SendCommand(ram);
+    SendDataBlock(rows, stride * h, mask);
+}
+
+/******************************************************************************
+function :	Stream a run-length image into one RAM without refreshing.
+            Runs go out as SPI fills and literals straight from flash, so
+            nothing is staged in RAM beyond the SPI chunk.
+parameter:
+	ram        : 0x24 (new) or 0x26 (old)
+	x, y, w, h : Target window; x and w in pixels, multiples of 8
+	rle        : Encoded image (PROGMEM), rows of (w + 7) / 8 bytes
+******************************************************************************/
+void Epd::WriteRamRLE(unsigned char ram, int x, int y, int w, int h, const unsigned char* rle)
+{
+    SetWindows(x, y, x + w - 1, y + h - 1);
+    SetCursor(x / 8, y);
+
+    SendCommand(ram);
+    for (;;) {
+        unsigned char c = pgm_read_byte(rle++);
+        if (c == 0x00) {
+            break;
+        } else if (c < 0x80) {
+            SendDataBlock(rle, c);
+            rle += c;
+        } else if (c < 0xC0) {
+            SendDataRepeat(0xFF, (c & 0x3F) + 1);
+        } else {
+            SendDataRepeat(pgm_read_byte(rle++), (c & 0x3F) + 1);
         }
     }
+}
 
-    //DISPLAY REFRESH
-    SendCommand(0x22);
-    SendData(0xff);
-    SendCommand(0x20);
+/******************************************************************************
+function :	Full refresh of a full-screen run-length image
+parameter:
+	rle : Encoded image (PROGMEM), EPD_WIDTH x EPD_HEIGHT
+******************************************************************************/
+void Epd::DisplayRLE(const unsigned char* rle)
+{
+    WriteRamRLE(0x24, 0, 0, EPD_WIDTH, EPD_HEIGHT, rle);
+    WriteRamRLE(0x26, 0, 0, EPD_WIDTH, EPD_HEIGHT, rle);
+
+    BeginRefresh(FULL);
+    WaitUntilIdle();
+}
+
+/******************************************************************************
+function :	Partial refresh of a single window of the frame buffer
+parameter:
+	x, y, w, h : Window, see WritePartWindow
+	frame_buffer : Full-size image data
+******************************************************************************/
+void Epd::DisplayPartWindow(int x, int y, int w, int h, const unsigned char* frame_buffer)
+{
+    WritePartWindow(x, y, w, h, frame_buffer);
+    TurnOnDisplayPart();
+}
+
+/******************************************************************************
+function :	Run the partial-update waveform on what is already in RAM
+parameter:
+******************************************************************************/
+void Epd::TurnOnDisplayPart(void)
+{
+    BeginRefresh(PART);
     WaitUntilIdle();
 }
 
@@ -399,12 +712,10 @@ void Epd::ClearPart(void)
     int w, h;
     w = (EPD_WIDTH % 8 == 0)? (EPD_WIDTH / 8 ): (EPD_WIDTH / 8 + 1);
     h = EPD_HEIGHT;
+    SetWindows(0, 0, EPD_WIDTH-1, EPD_HEIGHT-1);
+    SetCursor(0, 0);
     SendCommand(0x24);
-    for (int j = 0; j < h; j++) {
-        for (int i = 0; i < w; i++) {
-            SendData(0xff);
-        }
-    }
+    SendDataRepeat(0xff, w * h);
 
     //DISPLAY REFRESH
     SendCommand(0x22);
@@ -424,6 +735,20 @@ void Epd::Sleep()
     DelayMs(200);
 
     DigitalWrite(reset_pin, LOW);
+    this->mode = -1;    // only a reset wakes the controller
+}
+
+/******************************************************************************
+function :	Enter deep sleep mode 1 between updates. RAM 0x24/0x26 is kept,
+            so the next Init(PART) can continue partial refreshes against
+            the image on the panel. No settle delay and RST stays high.
+parameter:
+******************************************************************************/
+void Epd::DeepSleep(void)
+{
+    SendCommand(0x10); //enter deep sleep, mode 1 (RAM retained)
+    SendData(0x01);
+    this->mode = -1;    // next Init() resets the controller
 }
 
 /* END OF FILE */
@@ -41,6 +41,18 @@
 #define FAST			1
 #define PART			2
 
+// Custom partial-update waveforms (PROGMEM, 159 bytes each, see SetLut)
+#define WF_LUT_SIZE     159
+extern const unsigned char WF_ANIM_2IN13_V4[];      // short phase, pet frames
+extern const unsigned char WF_TIMER_2IN13_V4[];     // balanced, timer digits
+extern const unsigned char WF_CLEAN_2IN13_V4[];     // full swing, ghost clean
+
+// Run-length images (PROGMEM, see WriteRamRLE; encoder: tools/epdrle)
+//   0x00       end of image
+//   0x01-0x7F  that many literal bytes follow
+//   0x80-0xBF  (c & 0x3F) + 1 bytes of 0xFF (white)
+//   0xC0-0xFF  (c & 0x3F) + 1 copies of the next byte
+
 class Epd : EpdIf {
 public:
     unsigned long width;
@@ -52,23 +64,41 @@ public:
     Epd();
     ~Epd();
     int  Init(char Mode);
+    int  InitFast(int temperature);
     void SendCommand(unsigned char command);
     void SendData(unsigned char data);
+    void SendDataBlock(const unsigned char* data, unsigned int len, unsigned char mask = 0x00);
+    void SendDataRepeat(unsigned char data, unsigned int len);
     void WaitUntilIdle(void);
+    void BeginRefresh(char Mode);
+    bool IsRefreshDone(void);
 	void SetWindows(unsigned char Xstart, unsigned char Ystart, unsigned char Xend, unsigned char Yend);
 	void SetCursor(unsigned char Xstart, unsigned char Ystart);
-	void Lut(unsigned char *lut);
+	void Lut(const unsigned char *lut);
+	void SetLut(const unsigned char *lut);
     void Reset(void);
     void Clear(void);
     void Display(const unsigned char* frame_buffer);
     void Display1(const unsigned char* frame_buffer);
     void Display_Fast(const unsigned char* frame_buffer);
     void DisplayPartBaseImage(const unsigned char* frame_buffer);
+    void WriteBaseImage(const unsigned char* frame_buffer, unsigned char mask = 0x00);
     void DisplayPart(const unsigned char* frame_buffer);
+    void WritePartWindow(int x, int y, int w, int h, const unsigned char* frame_buffer, unsigned char mask = 0x00);
+    void WriteRamRows(unsigned char ram, int y, int h, const unsigned char* rows, unsigned char mask = 0x00);
+    void WriteRamRLE(unsigned char ram, int x, int y, int w, int h, const unsigned char* rle);
+    void DisplayRLE(const unsigned char* rle);
+    void DisplayPartWindow(int x, int y, int w, int h, const unsigned char* frame_buffer);
+    void TurnOnDisplayPart(void);
     void ClearPart(void);
     
     void Sleep(void);
+    void DeepSleep(void);
 private:
+    int  mode;          // mode the controller is set up for, -1 after reset/sleep
+    const unsigned char* lut;   // custom waveform in the LUT register, NULL = OTP
+    int  fast_temp;     // temperature (°C) written to 0x1A by Init(FAST)
+    bool if_ready;      // SPI + pins configured
     unsigned int reset_pin;
     unsigned int dc_pin;
     unsigned int cs_pin;
@@ -27,6 +27,7 @@
 
 #include "epdif.h"
 #include <spi.h>
+#include <string.h>
 
 EpdIf::EpdIf() {
 };
@@ -52,6 +53,44 @@ void EpdIf::SpiTransfer(unsigned char data) {
     digitalWrite(CS_PIN, HIGH);
 }
 
+/**
+ *  @brief: send a block of bytes with CS held low for the whole transfer.
+ *          SPI.transfer(buf, count) overwrites buf with the received bytes,
+ *          so the data is staged through a small stack chunk to leave the
+ *          caller's frame buffer untouched. Every byte is XORed with mask
+ *          on the way (0xFF sends the inverted image).
+ */
+void EpdIf::SpiTransfer(const unsigned char* data, unsigned int len, unsigned char mask) {
+    unsigned char chunk[SPI_CHUNK_SIZE];
+    digitalWrite(CS_PIN, LOW);
+    while (len > 0) {
+        unsigned int n = len < SPI_CHUNK_SIZE ? len : SPI_CHUNK_SIZE;
+        memcpy(chunk, data, n);
+        if (mask) {
+            for (unsigned int i = 0; i < n; i++) chunk[i] ^= mask;
+        }
+        SPI.transfer(chunk, n);
+        data += n;
+        len -= n;
+    }
+    digitalWrite(CS_PIN, HIGH);
+}
+
+/**
+ *  @brief: send the same byte len times with CS held low (RAM fills)
+ */
+void EpdIf::SpiTransferRepeat(unsigned char data, unsigned int len) {
+    unsigned char chunk[SPI_CHUNK_SIZE];
+    digitalWrite(CS_PIN, LOW);
+    while (len > 0) {
+        unsigned int n = len < SPI_CHUNK_SIZE ? len : SPI_CHUNK_SIZE;
+        memset(chunk, data, n);
+        SPI.transfer(chunk, n);
+        len -= n;
+    }
+    digitalWrite(CS_PIN, HIGH);
+}
+
 int EpdIf::IfInit(void) {
     pinMode(CS_PIN, OUTPUT);
     pinMode(RST_PIN, OUTPUT);
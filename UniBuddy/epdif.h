@@ -36,6 +36,9 @@
 #define CS_PIN          10
 #define BUSY_PIN        7
 
+// Bytes staged per SPI block transfer (see SpiTransfer(data, len))
+#define SPI_CHUNK_SIZE  64
+
 class EpdIf {
 public:
     EpdIf(void);
@@ -46,6 +49,8 @@ public:
     static int  DigitalRead(int pin);
     static void DelayMs(unsigned int delaytime);
     static void SpiTransfer(unsigned char data);
+    static void SpiTransfer(const unsigned char* data, unsigned int len, unsigned char mask = 0x00);
+    static void SpiTransferRepeat(unsigned char data, unsigned int len);
 };
 
 #endif
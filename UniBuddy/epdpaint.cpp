@@ -25,6 +25,8 @@
  */
 
 #include <avr/pgmspace.h>
+#include <math.h>
+#include <string.h>
 #include "epdpaint.h"
 
 Paint::Paint(unsigned char* image, int width, int height) {
@@ -33,18 +35,79 @@ Paint::Paint(unsigned char* image, int width, int height) {
     /* 1 byte = 8 pixels, so the width should be the multiple of 8 */
     this->width = width % 8 ? width + 8 - (width % 8) : width;
     this->height = height;
+    this->band_top = 0;
+    this->band_rows = height;
+    ResetClip();
+    ResetDirty();
 }
 
 Paint::~Paint() {
 }
 
 /**
- *  @brief: clear the image
+ *  @brief: clear the image (the current band when banded, only the clip
+ *          rectangle when one is set). The background is not counted as
+ *          drawn, so the dirty box is left alone.
  */
 void Paint::Clear(int colored) {
-    for (int x = 0; x < this->width; x++) {
-        for (int y = 0; y < this->height; y++) {
-            DrawAbsolutePixel(x, y, colored);
+    if (this->clip_x0 <= 0 && this->clip_y0 <= 0 &&
+        this->clip_x1 >= this->width - 1 && this->clip_y1 >= this->height - 1) {
+        memset(this->image, FillByte(colored), this->width / 8 * this->band_rows);
+    } else {
+        FillClipped(this->lim_x0, this->lim_y0, this->lim_x1, this->lim_y1, colored);
+    }
+}
+
+/**
+ *  @brief: the image byte for 8 pixels of the given color
+ */
+unsigned char Paint::FillByte(int colored) {
+    if (IF_INVERT_COLOR) {
+        return colored ? 0xFF : 0x00;
+    } else {
+        return colored ? 0x00 : 0xFF;
+    }
+}
+
+/**
+ *  @brief: fill a rectangle by absolute coordinates (inclusive; empty when
+ *          x1 < x0 or y1 < y0). Whole bytes are set per row, only the left
+ *          and right edge bytes are masked.
+ *          this function won't be affected by the rotate parameter.
+ */
+void Paint::FillAbsoluteRect(int x0, int y0, int x1, int y1, int colored) {
+    if (x0 < this->lim_x0) x0 = this->lim_x0;
+    if (x1 > this->lim_x1) x1 = this->lim_x1;
+    if (y0 < this->lim_y0) y0 = this->lim_y0;
+    if (y1 > this->lim_y1) y1 = this->lim_y1;
+    FillClipped(x0, y0, x1, y1, colored);
+    MarkDirty(x0, y0, x1, y1);
+}
+
+/**
+ *  @brief: FillAbsoluteRect for a rectangle already inside the limits
+ */
+void Paint::FillClipped(int x0, int y0, int x1, int y1, int colored) {
+    if (x1 < x0 || y1 < y0) {
+        return;
+    }
+
+    int stride = this->width / 8;
+    int xb0 = x0 / 8;
+    int xb1 = x1 / 8;
+    unsigned char lmask = 0xFF >> (x0 % 8);
+    unsigned char rmask = 0xFF << (7 - x1 % 8);
+    unsigned char fill = FillByte(colored);
+    if (xb0 == xb1) {
+        lmask &= rmask;
+    }
+
+    unsigned char* row = &this->image[(y0 - this->band_top) * stride];
+    for (int y = y0; y <= y1; y++, row += stride) {
+        row[xb0] = (row[xb0] & ~lmask) | (fill & lmask);
+        if (xb1 > xb0) {
+            memset(&row[xb0 + 1], fill, xb1 - xb0 - 1);
+            row[xb1] = (row[xb1] & ~rmask) | (fill & rmask);
         }
     }
 }
@@ -54,9 +117,11 @@ void Paint::Clear(int colored) {
  *          this function won't be affected by the rotate parameter.
  */
 void Paint::DrawAbsolutePixel(int x, int y, int colored) {
-    if (x < 0 || x >= this->width || y < 0 || y >= this->height) {
+    if (x < this->lim_x0 || x > this->lim_x1 || y < this->lim_y0 || y > this->lim_y1) {
         return;
     }
+    MarkDirty(x, y, x, y);
+    y -= this->band_top;
     if (IF_INVERT_COLOR) {
         if (colored) {
             image[(x + y * this->width) / 8] |= 0x80 >> (x % 8);
@@ -85,6 +150,7 @@ int Paint::GetWidth(void) {
 
 void Paint::SetWidth(int width) {
     this->width = width % 8 ? width + 8 - (width % 8) : width;
+    UpdateLimits();
 }
 
 int Paint::GetHeight(void) {
@@ -93,6 +159,7 @@ int Paint::GetHeight(void) {
 
 void Paint::SetHeight(int height) {
     this->height = height;
+    UpdateLimits();
 }
 
 int Paint::GetRotate(void) {
@@ -103,61 +170,299 @@ void Paint::SetRotate(int rotate){
     this->rotate = rotate;
 }
 
+/**
+ *  @brief: render into a horizontal strip of the frame. image then holds
+ *          only absolute rows top .. top + rows - 1; everything else is
+ *          clipped. SetBand(0, height) restores the whole frame.
+ */
+void Paint::SetBand(int top, int rows) {
+    this->band_top = top;
+    this->band_rows = rows;
+    UpdateLimits();
+}
+
+int Paint::GetBandTop(void) {
+    return this->band_top;
+}
+
+int Paint::GetBandRows(void) {
+    return this->band_rows;
+}
+
+/**
+ *  @brief: restrict all drawing (Clear included) to a rectangle given in
+ *          rotated coordinates, inclusive. It stays fixed on the panel if
+ *          the rotation changes afterwards.
+ */
+void Paint::SetClip(int x0, int y0, int x1, int y1) {
+    if (x1 < x0) { int t = x0; x0 = x1; x1 = t; }
+    if (y1 < y0) { int t = y0; y0 = y1; y1 = t; }
+    MapRect(&x0, &y0, &x1, &y1);
+    this->clip_x0 = x0;
+    this->clip_y0 = y0;
+    this->clip_x1 = x1;
+    this->clip_y1 = y1;
+    UpdateLimits();
+}
+
+void Paint::ResetClip(void) {
+    this->clip_x0 = 0;
+    this->clip_y0 = 0;
+    this->clip_x1 = this->width - 1;
+    this->clip_y1 = this->height - 1;
+    UpdateLimits();
+}
+
+/**
+ *  @brief: the clip rectangle in absolute coordinates, limited to the
+ *          buffer (not the band). returns false when it is empty.
+ */
+bool Paint::GetClip(int* x0, int* y0, int* x1, int* y1) {
+    *x0 = this->clip_x0 > 0 ? this->clip_x0 : 0;
+    *y0 = this->clip_y0 > 0 ? this->clip_y0 : 0;
+    *x1 = this->clip_x1 < this->width - 1 ? this->clip_x1 : this->width - 1;
+    *y1 = this->clip_y1 < this->height - 1 ? this->clip_y1 : this->height - 1;
+    return *x0 <= *x1 && *y0 <= *y1;
+}
+
+/**
+ *  @brief: bounding box, in absolute coordinates, of everything drawn since
+ *          the last ResetDirty() (glyph rows round out to whole bytes).
+ *          returns false when nothing was drawn.
+ */
+bool Paint::GetDirty(int* x0, int* y0, int* x1, int* y1) {
+    if (this->dirty_x1 < this->dirty_x0) {
+        return false;
+    }
+    *x0 = this->dirty_x0;
+    *y0 = this->dirty_y0;
+    *x1 = this->dirty_x1;
+    *y1 = this->dirty_y1;
+    return true;
+}
+
+void Paint::ResetDirty(void) {
+    this->dirty_x0 = this->width;
+    this->dirty_y0 = this->height;
+    this->dirty_x1 = -1;
+    this->dirty_y1 = -1;
+}
+
+inline void Paint::MarkDirty(int x0, int y0, int x1, int y1) {
+    if (x1 < x0 || y1 < y0) {
+        return;
+    }
+    if (x0 < this->dirty_x0) this->dirty_x0 = x0;
+    if (y0 < this->dirty_y0) this->dirty_y0 = y0;
+    if (x1 > this->dirty_x1) this->dirty_x1 = x1;
+    if (y1 > this->dirty_y1) this->dirty_y1 = y1;
+}
+
+/**
+ *  @brief: drawable area = clip rectangle within the buffer and the band
+ */
+void Paint::UpdateLimits(void) {
+    this->lim_x0 = this->clip_x0 > 0 ? this->clip_x0 : 0;
+    this->lim_x1 = this->clip_x1 < this->width - 1 ? this->clip_x1 : this->width - 1;
+    this->lim_y0 = this->clip_y0 > this->band_top ? this->clip_y0 : this->band_top;
+    this->lim_y1 = this->band_top + this->band_rows - 1;
+    if (this->clip_y1 < this->lim_y1) this->lim_y1 = this->clip_y1;
+}
+
+/**
+ *  @brief: convert a rectangle from rotated to absolute coordinates
+ *          (inclusive, x0 <= x1 and y0 <= y1 on both sides)
+ */
+void Paint::MapRect(int* x0, int* y0, int* x1, int* y1) {
+    int ax0, ay0, ax1, ay1;
+    if (this->rotate == ROTATE_90) {
+        ax0 = this->width - 1 - *y1;  ax1 = this->width - 1 - *y0;
+        ay0 = *x0;                    ay1 = *x1;
+    } else if (this->rotate == ROTATE_180) {
+        ax0 = this->width - 1 - *x1;  ax1 = this->width - 1 - *x0;
+        ay0 = this->height - 1 - *y1; ay1 = this->height - 1 - *y0;
+    } else if (this->rotate == ROTATE_270) {
+        ax0 = *y0;                    ax1 = *y1;
+        ay0 = this->height - 1 - *x1; ay1 = this->height - 1 - *x0;
+    } else {
+        ax0 = *x0;                    ax1 = *x1;
+        ay0 = *y0;                    ay1 = *y1;
+    }
+    *x0 = ax0;
+    *y0 = ay0;
+    *x1 = ax1;
+    *y1 = ay1;
+}
+
+/**
+ *  @brief: false if the box (rotated coordinates, inclusive) lies entirely
+ *          outside the band and clip, so a primitive can skip its loops
+ */
+bool Paint::BoxVisible(int x0, int y0, int x1, int y1) {
+    MapRect(&x0, &y0, &x1, &y1);
+    return x1 >= this->lim_x0 && x0 <= this->lim_x1 &&
+           y1 >= this->lim_y0 && y0 <= this->lim_y1;
+}
+
+/**
+ *  @brief: DrawPixel for a fixed rotation. Rotated and absolute bounds are
+ *          the same region, so one check against the limits (buffer, band
+ *          and clip) covers both.
+ */
+template <int R>
+inline void Paint::PixelAt(int x, int y, int colored) {
+    int ax, ay;
+    if (R == ROTATE_0) {
+        ax = x;
+        ay = y;
+    } else if (R == ROTATE_90) {
+        ax = this->width - 1 - y;
+        ay = x;
+    } else if (R == ROTATE_180) {
+        ax = this->width - 1 - x;
+        ay = this->height - 1 - y;
+    } else {
+        ax = y;
+        ay = this->height - 1 - x;
+    }
+    if (ax < this->lim_x0 || ax > this->lim_x1 || ay < this->lim_y0 || ay > this->lim_y1) {
+        return;
+    }
+    MarkDirty(ax, ay, ax, ay);
+    unsigned char* p = &this->image[(ay - this->band_top) * (this->width / 8) + ax / 8];
+    if ((colored != 0) == (IF_INVERT_COLOR != 0)) {
+        *p |= 0x80 >> (ax % 8);
+    } else {
+        *p &= ~(0x80 >> (ax % 8));
+    }
+}
+
 /**
  *  @brief: this draws a pixel by the coordinates
  */
 void Paint::DrawPixel(int x, int y, int colored) {
-    int point_temp;
     if (this->rotate == ROTATE_0) {
-        if(x < 0 || x >= this->width || y < 0 || y >= this->height) {
-            return;
-        }
-        DrawAbsolutePixel(x, y, colored);
+        PixelAt<ROTATE_0>(x, y, colored);
     } else if (this->rotate == ROTATE_90) {
-        if(x < 0 || x >= this->height || y < 0 || y >= this->width) {
-          return;
-        }
-        point_temp = x;
-        x = this->width - 1 - y;
-        y = point_temp;
-        DrawAbsolutePixel(x, y, colored);
+        PixelAt<ROTATE_90>(x, y, colored);
     } else if (this->rotate == ROTATE_180) {
-        if(x < 0 || x >= this->width || y < 0 || y >= this->height) {
-          return;
-        }
-        x = this->width - 1 - x;
-        y = this->height - 1 - y;
-        DrawAbsolutePixel(x, y, colored);
+        PixelAt<ROTATE_180>(x, y, colored);
     } else if (this->rotate == ROTATE_270) {
-        if(x < 0 || x >= this->height || y < 0 || y >= this->width) {
-          return;
+        PixelAt<ROTATE_270>(x, y, colored);
+    }
+}
+
+/* bit order of one nibble reversed, for the mirrored rotations */
+static const unsigned char REVERSE_NIBBLE[16] = {
+    0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+    0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF
+};
+
+/**
+ *  @brief: draw the set bits of a 1 bpp row (MSB = leftmost pixel) at
+ *          absolute (x, y); clear bits are left alone. x may be unaligned
+ *          or negative, every source byte lands in at most two image bytes.
+ *          this function won't be affected by the rotate parameter.
+ */
+void Paint::BlitAbsoluteRow(int x, int y, const unsigned char* bits, int bytes, int colored) {
+    if (y < this->lim_y0 || y > this->lim_y1) {
+        return;
+    }
+    unsigned char* row = &this->image[(y - this->band_top) * (this->width / 8)];
+    int xb = x >= 0 ? x / 8 : -((7 - x) / 8);
+    int shift = x - xb * 8;
+    bool set = (colored != 0) == (IF_INVERT_COLOR != 0);
+    int lb = this->lim_x0 / 8;
+    int rb = this->lim_x1 / 8;
+    unsigned char lmask = 0xFF >> (this->lim_x0 % 8);
+    unsigned char rmask = 0xFF << (7 - this->lim_x1 % 8);
+    int first = rb + 1, last = lb - 1;
+
+    /* source byte k covers image bytes xb + k (high part) and xb + k + 1 */
+    for (int k = 0; k <= bytes; k++) {
+        int b = xb + k;
+        unsigned char m = 0;
+        if (k < bytes) m |= bits[k] >> shift;
+        if (k > 0 && shift) m |= (unsigned char)(bits[k - 1] << (8 - shift));
+        if (!m || b < lb || b > rb) {
+            continue;
+        }
+        if (b == lb) m &= lmask;
+        if (b == rb) m &= rmask;
+        if (!m) {
+            continue;
+        }
+        row[b] = set ? (row[b] | m) : (row[b] & ~m);
+        if (b < first) first = b;
+        last = b;
+    }
+    if (last >= first) {
+        MarkDirty(first * 8 > this->lim_x0 ? first * 8 : this->lim_x0, y,
+                  last * 8 + 7 < this->lim_x1 ? last * 8 + 7 : this->lim_x1, y);
+    }
+}
+
+/**
+ *  @brief: copy one glyph row out of a font table, dropping the padding
+ *          bits; reversed for the mirrored rotations, in which case the
+ *          padding ends up in front (pad bits left of the first pixel)
+ */
+static void ReadGlyphRow(unsigned char* buf, const unsigned char* ptr, int bytes, int pad, bool reverse) {
+    for (int k = 0; k < bytes; k++) {
+        buf[k] = pgm_read_byte(ptr + k);
+    }
+    buf[bytes - 1] &= 0xFF << pad;
+    if (reverse) {
+        for (int k = 0; k < bytes / 2; k++) {
+            unsigned char t = buf[k];
+            buf[k] = buf[bytes - 1 - k];
+            buf[bytes - 1 - k] = t;
+        }
+        for (int k = 0; k < bytes; k++) {
+            buf[k] = (REVERSE_NIBBLE[buf[k] & 0x0F] << 4) | REVERSE_NIBBLE[buf[k] >> 4];
         }
-        point_temp = x;
-        x = y;
-        y = this->height - 1 - point_temp;
-        DrawAbsolutePixel(x, y, colored);
     }
 }
 
 /**
- *  @brief: this draws a charactor on the frame buffer but not refresh
+ *  @brief: this draws a charactor on the frame buffer but not refresh.
+ *          Each glyph row is blitted as shifted bytes; in the landscape
+ *          rotations the column-major table (font->table_rot) supplies
+ *          the framebuffer rows, so nothing is transposed at runtime.
  */
 void Paint::DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored) {
-    int i, j;
-    unsigned int char_offset = (ascii_char - ' ') * font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
-    const unsigned char* ptr = &font->table[char_offset];
-
-    for (j = 0; j < font->Height; j++) {
-        for (i = 0; i < font->Width; i++) {
-            if (pgm_read_byte(ptr) & (0x80 >> (i % 8))) {
-                DrawPixel(x + i, y + j, colored);
-            }
-            if (i % 8 == 7) {
-                ptr++;
+    unsigned char buf[(MAX_HEIGHT_FONT + 7) / 8];
+    int glyph = ascii_char - ' ';
+
+    if (!BoxVisible(x, y, x + font->Width - 1, y + font->Height - 1)) {
+        return;
+    }
+
+    if (this->rotate == ROTATE_0 || this->rotate == ROTATE_180) {
+        int bytes = (font->Width + 7) / 8;
+        int pad = bytes * 8 - font->Width;
+        const unsigned char* ptr = &font->table[glyph * font->Height * bytes];
+        for (int j = 0; j < font->Height; j++, ptr += bytes) {
+            ReadGlyphRow(buf, ptr, bytes, pad, this->rotate == ROTATE_180);
+            if (this->rotate == ROTATE_0) {
+                BlitAbsoluteRow(x, y + j, buf, bytes, colored);
+            } else {
+                BlitAbsoluteRow(this->width - x - font->Width - pad,
+                                this->height - 1 - y - j, buf, bytes, colored);
             }
         }
-        if (font->Width % 8 != 0) {
-            ptr++;
+    } else {
+        int bytes = (font->Height + 7) / 8;
+        int pad = bytes * 8 - font->Height;
+        const unsigned char* ptr = &font->table_rot[glyph * font->Width * bytes];
+        for (int i = 0; i < font->Width; i++, ptr += bytes) {
+            ReadGlyphRow(buf, ptr, bytes, pad, this->rotate == ROTATE_90);
+            if (this->rotate == ROTATE_270) {
+                BlitAbsoluteRow(y, this->height - 1 - x - i, buf, bytes, colored);
+            } else {
+                BlitAbsoluteRow(this->width - y - font->Height - pad, x + i,
+                                buf, bytes, colored);
+            }
         }
     }
 }
@@ -182,10 +487,8 @@ void Paint::DrawStringAt(int x, int y, const char* text, sFONT* font, int colore
     }
 }
 
-/**
-*  @brief: this draws a line on the frame buffer
-*/
-void Paint::DrawLine(int x0, int y0, int x1, int y1, int colored) {
+template <int R>
+void Paint::LineAt(int x0, int y0, int x1, int y1, int colored) {
     /* Bresenham algorithm */
     int dx = x1 - x0 >= 0 ? x1 - x0 : x0 - x1;
     int sx = x0 < x1 ? 1 : -1;
@@ -194,7 +497,7 @@ void Paint::DrawLine(int x0, int y0, int x1, int y1, int colored) {
     int err = dx + dy;
 
     while((x0 != x1) && (y0 != y1)) {
-        DrawPixel(x0, y0 , colored);
+        PixelAt<R>(x0, y0 , colored);
         if (2 * err >= dy) {     
             err += dy;
             x0 += sx;
@@ -206,24 +509,37 @@ void Paint::DrawLine(int x0, int y0, int x1, int y1, int colored) {
     }
 }
 
+/**
+*  @brief: this draws a line on the frame buffer
+*/
+void Paint::DrawLine(int x0, int y0, int x1, int y1, int colored) {
+    if (!BoxVisible(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1,
+                     x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0)) {
+        return;
+    }
+    if (this->rotate == ROTATE_0) {
+        LineAt<ROTATE_0>(x0, y0, x1, y1, colored);
+    } else if (this->rotate == ROTATE_90) {
+        LineAt<ROTATE_90>(x0, y0, x1, y1, colored);
+    } else if (this->rotate == ROTATE_180) {
+        LineAt<ROTATE_180>(x0, y0, x1, y1, colored);
+    } else if (this->rotate == ROTATE_270) {
+        LineAt<ROTATE_270>(x0, y0, x1, y1, colored);
+    }
+}
+
 /**
 *  @brief: this draws a horizontal line on the frame buffer
 */
 void Paint::DrawHorizontalLine(int x, int y, int line_width, int colored) {
-    int i;
-    for (i = x; i < x + line_width; i++) {
-        DrawPixel(i, y, colored);
-    }
+    FillRect(x, y, x + line_width - 1, y, colored);
 }
 
 /**
 *  @brief: this draws a vertical line on the frame buffer
 */
 void Paint::DrawVerticalLine(int x, int y, int line_height, int colored) {
-    int i;
-    for (i = y; i < y + line_height; i++) {
-        DrawPixel(x, i, colored);
-    }
+    FillRect(x, y, x, y + line_height - 1, colored);
 }
 
 /**
@@ -247,32 +563,44 @@ void Paint::DrawRectangle(int x0, int y0, int x1, int y1, int colored) {
 */
 void Paint::DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored) {
     int min_x, min_y, max_x, max_y;
-    int i;
     min_x = x1 > x0 ? x0 : x1;
     max_x = x1 > x0 ? x1 : x0;
     min_y = y1 > y0 ? y0 : y1;
     max_y = y1 > y0 ? y1 : y0;
-    
-    for (i = min_x; i <= max_x; i++) {
-      DrawVerticalLine(i, min_y, max_y - min_y + 1, colored);
-    }
+
+    FillRect(min_x, min_y, max_x, max_y, colored);
 }
 
 /**
-*  @brief: this draws a circle
+*  @brief: fill a rectangle given in rotated coordinates (inclusive; empty
+*          when x1 < x0 or y1 < y0). The corners are mapped to absolute
+*          coordinates once and the span is filled with FillAbsoluteRect.
 */
-void Paint::DrawCircle(int x, int y, int radius, int colored) {
-    /* Bresenham algorithm */
+void Paint::FillRect(int x0, int y0, int x1, int y1, int colored) {
+    if (x1 < x0 || y1 < y0) {
+        return;
+    }
+    MapRect(&x0, &y0, &x1, &y1);
+    FillAbsoluteRect(x0, y0, x1, y1, colored);
+}
+
+template <int R>
+void Paint::CircleAt(int x, int y, int radius, int colored) {
+    /* Bresenham algorithm over one octant, mirrored 8 ways */
     int x_pos = -radius;
     int y_pos = 0;
     int err = 2 - 2 * radius;
     int e2;
 
     do {
-        DrawPixel(x - x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y - y_pos, colored);
-        DrawPixel(x - x_pos, y - y_pos, colored);
+        PixelAt<R>(x - x_pos, y + y_pos, colored);
+        PixelAt<R>(x + x_pos, y + y_pos, colored);
+        PixelAt<R>(x + x_pos, y - y_pos, colored);
+        PixelAt<R>(x - x_pos, y - y_pos, colored);
+        PixelAt<R>(x + y_pos, y - x_pos, colored);
+        PixelAt<R>(x - y_pos, y - x_pos, colored);
+        PixelAt<R>(x + y_pos, y + x_pos, colored);
+        PixelAt<R>(x - y_pos, y + x_pos, colored);
         e2 = err;
         if (e2 <= y_pos) {
             err += ++y_pos * 2 + 1;
@@ -283,11 +611,30 @@ void Paint::DrawCircle(int x, int y, int radius, int colored) {
         if (e2 > x_pos) {
             err += ++x_pos * 2 + 1;
         }
-    } while (x_pos <= 0);
+    } while (-x_pos >= y_pos);
 }
 
 /**
-*  @brief: this draws a filled circle
+*  @brief: this draws a circle
+*/
+void Paint::DrawCircle(int x, int y, int radius, int colored) {
+    if (!BoxVisible(x - radius, y - radius, x + radius, y + radius)) {
+        return;
+    }
+    if (this->rotate == ROTATE_0) {
+        CircleAt<ROTATE_0>(x, y, radius, colored);
+    } else if (this->rotate == ROTATE_90) {
+        CircleAt<ROTATE_90>(x, y, radius, colored);
+    } else if (this->rotate == ROTATE_180) {
+        CircleAt<ROTATE_180>(x, y, radius, colored);
+    } else if (this->rotate == ROTATE_270) {
+        CircleAt<ROTATE_270>(x, y, radius, colored);
+    }
+}
+
+/**
+*  @brief: this draws a filled circle. The first Bresenham step on each row
+*          has the widest span, so every row is filled exactly once.
 */
 void Paint::DrawFilledCircle(int x, int y, int radius, int colored) {
     /* Bresenham algorithm */
@@ -295,14 +642,20 @@ void Paint::DrawFilledCircle(int x, int y, int radius, int colored) {
     int y_pos = 0;
     int err = 2 - 2 * radius;
     int e2;
+    int last_row = -1;
+
+    if (!BoxVisible(x - radius, y - radius, x + radius, y + radius)) {
+        return;
+    }
 
     do {
-        DrawPixel(x - x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y + y_pos, colored);
-        DrawPixel(x + x_pos, y - y_pos, colored);
-        DrawPixel(x - x_pos, y - y_pos, colored);
-        DrawHorizontalLine(x + x_pos, y + y_pos, 2 * (-x_pos) + 1, colored);
-        DrawHorizontalLine(x + x_pos, y - y_pos, 2 * (-x_pos) + 1, colored);
+        if (y_pos != last_row) {
+            FillRect(x + x_pos, y + y_pos, x - x_pos, y + y_pos, colored);
+            if (y_pos != 0) {
+                FillRect(x + x_pos, y - y_pos, x - x_pos, y - y_pos, colored);
+            }
+            last_row = y_pos;
+        }
         e2 = err;
         if (e2 <= y_pos) {
             err += ++y_pos * 2 + 1;
@@ -316,6 +669,284 @@ void Paint::DrawFilledCircle(int x, int y, int radius, int colored) {
     } while(x_pos <= 0);
 }
 
+/**
+ *  @brief: rotated -> absolute coordinates of a single point
+ */
+void Paint::MapPoint(int x, int y, int* ax, int* ay) {
+    int x1 = x, y1 = y;
+    MapRect(&x, &y, &x1, &y1);
+    *ax = x;
+    *ay = y;
+}
+
+/* a / b rounded to nearest, b > 0 */
+static int RoundDiv(long a, long b) {
+    long n = 2 * a + b;
+    long d = 2 * b;
+    return (int)(n >= 0 ? n / d : -((-n + d - 1) / d));
+}
+
+/**
+ *  @brief: x extent, in absolute coordinates, of a convex polygon (given
+ *          in rotated coordinates) on absolute row y. Edge crossings are
+ *          rounded to the nearest pixel. returns false if the row misses it.
+ */
+bool Paint::ConvexSpan(const int* xs, const int* ys, int n, int y, int* lo, int* hi) {
+    bool hit = false;
+    int xa, ya, xb, yb;
+    MapPoint(xs[n - 1], ys[n - 1], &xa, &ya);
+    for (int i = 0; i < n; i++, xa = xb, ya = yb) {
+        MapPoint(xs[i], ys[i], &xb, &yb);
+        if ((y < ya && y < yb) || (y > ya && y > yb)) {
+            continue;
+        }
+        int c0, c1;
+        if (ya == yb) {
+            c0 = xa < xb ? xa : xb;
+            c1 = xa < xb ? xb : xa;
+        } else {
+            long num = (long)(y - ya) * (xb - xa);
+            c0 = c1 = yb > ya ? xa + RoundDiv(num, yb - ya) : xa + RoundDiv(-num, ya - yb);
+        }
+        if (!hit || c0 < *lo) *lo = c0;
+        if (!hit || c1 > *hi) *hi = c1;
+        hit = true;
+    }
+    return hit;
+}
+
+/**
+ *  @brief: this draws a filled convex polygon (vertices in rotated
+ *          coordinates, either winding). Vertices are mapped to absolute
+ *          coordinates and the polygon is filled one span per panel row.
+ */
+void Paint::DrawFilledPolygon(const int* xs, const int* ys, int n, int colored) {
+    if (n < 1) {
+        return;
+    }
+    int ax, ay, top, bottom;
+    MapPoint(xs[0], ys[0], &ax, &top);
+    bottom = top;
+    for (int i = 1; i < n; i++) {
+        MapPoint(xs[i], ys[i], &ax, &ay);
+        if (ay < top) top = ay;
+        if (ay > bottom) bottom = ay;
+    }
+    if (top < this->lim_y0) top = this->lim_y0;
+    if (bottom > this->lim_y1) bottom = this->lim_y1;
+
+    int lo, hi;
+    for (int y = top; y <= bottom; y++) {
+        if (ConvexSpan(xs, ys, n, y, &lo, &hi)) {
+            FillAbsoluteRect(lo, y, hi, y, colored);
+        }
+    }
+}
+
+/**
+ *  @brief: this draws a filled triangle
+ */
+void Paint::DrawFilledTriangle(int x0, int y0, int x1, int y1, int x2, int y2, int colored) {
+    int xs[3] = { x0, x1, x2 };
+    int ys[3] = { y0, y1, y2 };
+    DrawFilledPolygon(xs, ys, 3, colored);
+}
+
+/**
+ *  @brief: this draws a line 2 * half + 1 pixels wide with round caps.
+ *          The stroke is a capsule approximated by a convex 10-gon (each
+ *          cap is a half octagon), so every pixel is covered exactly once
+ *          and steep diagonals have no gaps.
+ */
+void Paint::DrawThickLine(int x0, int y0, int x1, int y1, int half, int colored) {
+    if (half <= 0) {
+        DrawLine(x0, y0, x1, y1, colored);
+        return;
+    }
+    float ux = 1.0f, uy = 0.0f;             // unit vector along the stroke
+    float len = sqrtf((float)(x1 - x0) * (x1 - x0) + (float)(y1 - y0) * (y1 - y0));
+    if (len > 0.0f) {
+        ux = (x1 - x0) / len;
+        uy = (y1 - y0) / len;
+    }
+    /* cap directions: normal, 45 degrees out, straight out, 45, -normal */
+    static const float CAP[5][2] = {
+        { 0.0f, 1.0f }, { 0.7071f, 0.7071f }, { 1.0f, 0.0f },
+        { 0.7071f, -0.7071f }, { 0.0f, -1.0f }
+    };
+    int xs[10], ys[10];
+    for (int k = 0; k < 5; k++) {
+        /* (a, b) = a * u + b * n with n = (-uy, ux) */
+        float ox = half * (CAP[k][0] * ux - CAP[k][1] * uy);
+        float oy = half * (CAP[k][0] * uy + CAP[k][1] * ux);
+        xs[k]     = x1 + (int)floorf(ox + 0.5f);
+        ys[k]     = y1 + (int)floorf(oy + 0.5f);
+        xs[k + 5] = x0 - (int)floorf(ox + 0.5f);
+        ys[k + 5] = y0 - (int)floorf(oy + 0.5f);
+    }
+    DrawFilledPolygon(xs, ys, 10, colored);
+}
+
+/**
+ *  @brief: combine a 1 bpp row (MSB = leftmost pixel, 1 = colored) into
+ *          the image at absolute (x, y) with a raster operation. Only
+ *          pixels whose mask bit is set are changed; n pixels wide.
+ *          this function won't be affected by the rotate parameter.
+ */
+void Paint::RopAbsoluteRow(int x, int y, const unsigned char* bits, const unsigned char* mask, int n, int rop) {
+    if (y < this->lim_y0 || y > this->lim_y1 || n <= 0) {
+        return;
+    }
+    int x0 = x > this->lim_x0 ? x : this->lim_x0;
+    int x1 = x + n - 1 < this->lim_x1 ? x + n - 1 : this->lim_x1;
+    if (x1 < x0) {
+        return;
+    }
+    unsigned char* row = &this->image[(y - this->band_top) * (this->width / 8)];
+    int bytes = (n + 7) / 8;
+    int shift = x & 7;                      // x - 8 * floor(x / 8)
+    int xb = (x - shift) / 8;
+    int lb = x0 / 8, rb = x1 / 8;
+    int first = rb + 1, last = lb - 1;
+
+    for (int b = lb; b <= rb; b++) {
+        /* source byte k lands in image bytes xb + k and xb + k + 1 */
+        int k = b - xb;
+        unsigned char s = 0, m = 0;
+        if (k < bytes) {
+            s |= bits[k] >> shift;
+            m |= mask[k] >> shift;
+        }
+        if (k > 0 && shift) {
+            s |= (unsigned char)(bits[k - 1] << (8 - shift));
+            m |= (unsigned char)(mask[k - 1] << (8 - shift));
+        }
+        if (b == lb) m &= 0xFF >> (x0 & 7);
+        if (b == rb) m &= 0xFF << (7 - (x1 & 7));
+        if (!m) {
+            continue;
+        }
+        unsigned char d = IF_INVERT_COLOR ? row[b] : ~row[b];
+        unsigned char r;
+        switch (rop) {
+            case ROP_OR:     r = d | s;  break;
+            case ROP_AND:    r = d & s;  break;
+            case ROP_XOR:    r = d ^ s;  break;
+            case ROP_INVERT: r = ~s;     break;
+            default:         r = s;      break;
+        }
+        r = (d & ~m) | (r & m);
+        row[b] = IF_INVERT_COLOR ? r : ~r;
+        if (b < first) first = b;
+        last = b;
+    }
+    if (last >= first) {
+        MarkDirty(first * 8 > x0 ? first * 8 : x0, y, last * 8 + 7 < x1 ? last * 8 + 7 : x1, y);
+    }
+}
+
+/**
+ *  @brief: copy one n-pixel bitmap row (MSB first) out of PROGMEM into
+ *          buf, left-aligned; reversed for the mirrored rotations, with
+ *          the padding shifted back out so pixel 0 is still the MSB
+ */
+static void ReadBitmapRow(unsigned char* buf, const unsigned char* ptr, int n, bool reverse) {
+    int bytes = (n + 7) / 8;
+    int pad = bytes * 8 - n;
+    ReadGlyphRow(buf, ptr, bytes, pad, reverse);
+    if (reverse && pad) {
+        for (int k = 0; k < bytes; k++) {
+            buf[k] = (unsigned char)(buf[k] << pad) | (k + 1 < bytes ? buf[k + 1] >> (8 - pad) : 0);
+        }
+    }
+}
+
+/**
+ *  @brief: this draws a 1 bpp bitmap (PROGMEM, rows of (w + 7) / 8 bytes,
+ *          MSB first, 1 = colored) with its top left corner at (x, y) in
+ *          rotated coordinates. rop is one of ROP_COPY / OR / AND / XOR /
+ *          INVERT. mask has the same layout; only pixels set in it are
+ *          touched (NULL = the whole w x h box). Pass the bitmap itself
+ *          as the mask to draw just its set pixels.
+ *          ROTATE_0 / ROTATE_180 read each sprite row as whole bytes. In
+ *          the landscape rotations a sprite column is a panel row, so
+ *          bitmap_rot / mask_rot (w rows of (h + 7) / 8 bytes, top row in
+ *          the MSB, see sprites_rot.h) are read the same way; without
+ *          them every pixel is gathered from the row-major bitmap.
+ */
+void Paint::DrawBitmap(int x, int y, const unsigned char* bitmap, int w, int h, int rop,
+                       const unsigned char* mask, const unsigned char* bitmap_rot,
+                       const unsigned char* mask_rot) {
+    if (w <= 0 || h <= 0 || !BoxVisible(x, y, x + w - 1, y + h - 1)) {
+        return;
+    }
+    int ax0 = x, ay0 = y, ax1 = x + w - 1, ay1 = y + h - 1;
+    MapRect(&ax0, &ay0, &ax1, &ay1);
+    int top = ay0 > this->lim_y0 ? ay0 : this->lim_y0;
+    int bottom = ay1 < this->lim_y1 ? ay1 : this->lim_y1;
+    int left = ax0 > this->lim_x0 ? ax0 : this->lim_x0;
+    int right = ax1 < this->lim_x1 ? ax1 : this->lim_x1;
+    int stride = (w + 7) / 8;
+    unsigned char src[32], msk[32];
+
+    bool landscape = this->rotate == ROTATE_90 || this->rotate == ROTATE_270;
+    const unsigned char* rows = landscape ? bitmap_rot : bitmap;
+    const unsigned char* mrows = landscape ? mask_rot : mask;
+    int n = landscape ? h : w;                 // pixels per panel row
+    int bytes = (n + 7) / 8;
+    if (rows && (!mask || mrows) && bytes <= (int)sizeof(src)) {
+        bool reverse = this->rotate == ROTATE_180 || this->rotate == ROTATE_90;
+        for (int ay = top; ay <= bottom; ay++) {
+            /* source row: sprite row (0 / 180) or sprite column (90 / 270) */
+            int r = ay - ay0, s;
+            if (this->rotate == ROTATE_90 || this->rotate == ROTATE_0) {
+                s = r;
+            } else if (this->rotate == ROTATE_180) {
+                s = h - 1 - r;
+            } else {
+                s = w - 1 - r;
+            }
+            ReadBitmapRow(src, &rows[s * bytes], n, reverse);
+            if (mrows) {
+                ReadBitmapRow(msk, &mrows[s * bytes], n, reverse);
+            } else {
+                memset(msk, 0xFF, bytes);
+            }
+            RopAbsoluteRow(ax0, ay, src, msk, n, rop);
+        }
+        return;
+    }
+
+    for (int ay = top; ay <= bottom; ay++) {
+        /* sprite pixel of absolute (ax0 + k, ay) is (sx0 + k * dx, sy0 + k * dy) */
+        int r = ay - ay0, sx0, sy0, dx, dy;
+        if (this->rotate == ROTATE_90) {
+            sx0 = r;         sy0 = h - 1;     dx = 0;  dy = -1;
+        } else if (this->rotate == ROTATE_180) {
+            sx0 = w - 1;     sy0 = h - 1 - r; dx = -1; dy = 0;
+        } else if (this->rotate == ROTATE_270) {
+            sx0 = w - 1 - r; sy0 = 0;         dx = 0;  dy = 1;
+        } else {
+            sx0 = 0;         sy0 = r;         dx = 1;  dy = 0;
+        }
+        for (int cx = left; cx <= right; cx += 8 * (int)sizeof(src)) {
+            int n = right - cx + 1;
+            if (n > 8 * (int)sizeof(src)) n = 8 * (int)sizeof(src);
+            memset(src, 0, (n + 7) / 8);
+            memset(msk, mask ? 0 : 0xFF, (n + 7) / 8);
+            for (int i = 0; i < n; i++) {
+                int k = cx - ax0 + i;
+                int sx = sx0 + k * dx, sy = sy0 + k * dy;
+                int off = sy * stride + sx / 8;
+                unsigned char bit = 0x80 >> (sx & 7);
+                if (pgm_read_byte(&bitmap[off]) & bit) src[i / 8] |= 0x80 >> (i & 7);
+                if (mask && (pgm_read_byte(&mask[off]) & bit)) msk[i / 8] |= 0x80 >> (i & 7);
+            }
+            RopAbsoluteRow(cx, ay, src, msk, n, rop);
+        }
+    }
+}
+
 /* END OF FILE */
 
 
@@ -36,6 +36,14 @@
 // Color inverse. 1 or 0 = set or reset a bit if set a colored pixel
 #define IF_INVERT_COLOR     1
 
+// DrawBitmap raster operations (bitmap 1 = colored)
+#define ROP_COPY            0   // dst = src
+#define ROP_OR              1   // dst = dst | src
+#define ROP_AND             2   // dst = dst & src
+#define ROP_XOR             3   // dst = dst ^ src
+#define ROP_INVERT          4   // dst = ~src
+
+#include <stddef.h>
 #include "fonts.h"
 
 class Paint {
@@ -49,8 +57,17 @@ public:
     void SetHeight(int height);
     int  GetRotate(void);
     void SetRotate(int rotate);
+    void SetBand(int top, int rows);
+    int  GetBandTop(void);
+    int  GetBandRows(void);
+    void SetClip(int x0, int y0, int x1, int y1);
+    void ResetClip(void);
+    bool GetClip(int* x0, int* y0, int* x1, int* y1);
+    bool GetDirty(int* x0, int* y0, int* x1, int* y1);
+    void ResetDirty(void);
     unsigned char* GetImage(void);
     void DrawAbsolutePixel(int x, int y, int colored);
+    void FillAbsoluteRect(int x0, int y0, int x1, int y1, int colored);
     void DrawPixel(int x, int y, int colored);
     void DrawCharAt(int x, int y, char ascii_char, sFONT* font, int colored);
     void DrawStringAt(int x, int y, const char* text, sFONT* font, int colored);
@@ -59,14 +76,44 @@ public:
     void DrawVerticalLine(int x, int y, int height, int colored);
     void DrawRectangle(int x0, int y0, int x1, int y1, int colored);
     void DrawFilledRectangle(int x0, int y0, int x1, int y1, int colored);
+    void FillRect(int x0, int y0, int x1, int y1, int colored);
     void DrawCircle(int x, int y, int radius, int colored);
     void DrawFilledCircle(int x, int y, int radius, int colored);
+    void DrawFilledPolygon(const int* xs, const int* ys, int n, int colored);
+    void DrawFilledTriangle(int x0, int y0, int x1, int y1, int x2, int y2, int colored);
+    void DrawThickLine(int x0, int y0, int x1, int y1, int half, int colored);
+    void DrawBitmap(int x, int y, const unsigned char* bitmap, int w, int h, int rop,
+                    const unsigned char* mask = NULL, const unsigned char* bitmap_rot = NULL,
+                    const unsigned char* mask_rot = NULL);
 
 private:
+    bool BoxVisible(int x0, int y0, int x1, int y1);
+    void MapRect(int* x0, int* y0, int* x1, int* y1);
+    void MapPoint(int x, int y, int* ax, int* ay);
+    bool ConvexSpan(const int* xs, const int* ys, int n, int y, int* lo, int* hi);
+    void UpdateLimits(void);
+    void MarkDirty(int x0, int y0, int x1, int y1);
+    void FillClipped(int x0, int y0, int x1, int y1, int colored);
+    unsigned char FillByte(int colored);
+    void BlitAbsoluteRow(int x, int y, const unsigned char* bits, int bytes, int colored);
+    void RopAbsoluteRow(int x, int y, const unsigned char* bits, const unsigned char* mask, int n, int rop);
+
+    /* per-pixel paths specialised on ROTATE_*; the public primitives pick
+     * the instance once per call, so the inner loops carry no branch on
+     * rotate and a single bounds check */
+    template <int R> void PixelAt(int x, int y, int colored);
+    template <int R> void LineAt(int x0, int y0, int x1, int y1, int colored);
+    template <int R> void CircleAt(int x, int y, int radius, int colored);
+
     unsigned char* image;
     int width;
     int height;
     int rotate;
+    int band_top;       // first absolute row held in image
+    int band_rows;      // rows held in image (height when not banded)
+    int clip_x0, clip_y0, clip_x1, clip_y1;     // clip rectangle, absolute
+    int lim_x0, lim_y0, lim_x1, lim_y1;         // clip within buffer and band
+    int dirty_x0, dirty_y0, dirty_x1, dirty_y1; // drawn area, absolute
 };
 
 #endif
@@ -2516,6 +2516,7 @@ sFONT Font24 = {
   Font24_Table,
   17, /* Width */
   24, /* Height */
+  Font24_TableRot,
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
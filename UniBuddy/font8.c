@@ -1000,6 +1000,7 @@ sFONT Font8 = {
   Font8_Table,
   5, /* Width */
   8, /* Height */
+  Font8_TableRot,
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
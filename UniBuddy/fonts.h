@@ -56,6 +56,7 @@ typedef struct _tFont
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const uint8_t *table_rot;   /* column-major copy for ROTATE_90/270 (fonts_rot.c) */
   
 } sFONT;
 
@@ -65,6 +66,12 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+extern const uint8_t Font24_TableRot[];
+extern const uint8_t Font20_TableRot[];
+extern const uint8_t Font16_TableRot[];
+extern const uint8_t Font12_TableRot[];
+extern const uint8_t Font8_TableRot[];
+
 #ifdef __cplusplus
 }
 #endif
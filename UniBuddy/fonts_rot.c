@@ -0,0 +1,6106 @@
+/*
+ * fonts_rot.c — column-major copies of Font8..Font24 for the
+ * landscape rotations. Generated by tools/fontrot; do not edit.
+ */
+#include "fonts.h"
+#include <avr/pgmspace.h>
+
+// 5x8: 95 glyphs x 5 columns x 1 bytes
+const uint8_t Font8_TableRot[] PROGMEM =
+{
+	// @0 ' '
+	0x00,
+	0x00,
+	0x00,
+	0x00,
+	0x00,
+
+	// @5 '!'
+	0x00,
+	0x00,
+	0xF4,
+	0x00,
+	0x00,
+
+	// @10 '"'
+	0x00,
+	0xC0,
+	0x00,
+	0xC0,
+	0x00,
+
+	// @15 '#'
+	0x2A,
+	0x7C,
+	0xAA,
+	0x7C,
+	0xA8,
+
+	// @20 '$'
+	0x00,
+	0x24,
+	0xF6,
+	0x58,
+	0x00,
+
+	// @25 '%'
+	0x00,
+	0x10,
+	0xD0,
+	0x2C,
+	0x20,
+
+	// @30 '&'
+	0x00,
+	0x1C,
+	0x74,
+	0x4C,
+	0x44,
+
+	// @35 '''
+	0x00,
+	0x00,
+	0xE0,
+	0x00,
+	0x00,
+
+	// @40 '('
+	0x00,
+	0x00,
+	0x7C,
+	0x82,
+	0x00,
+
+	// @45 ')'
+	0x00,
+	0x82,
+	0x7C,
+	0x00,
+	0x00,
+
+	// @50 '*'
+	0x00,
+	0x50,
+	0xE0,
+	0x50,
+	0x00,
+
+	// @55 '+'
+	0x10,
+	0x10,
+	0x7C,
+	0x10,
+	0x10,
+
+	// @60 ','
+	0x00,
+	0x00,
+	0x06,
+	0x08,
+	0x00,
+
+	// @65 '-'
+	0x00,
+	0x10,
+	0x10,
+	0x10,
+	0x00,
+
+	// @70 '.'
+	0x00,
+	0x00,
+	0x04,
+	0x00,
+	0x00,
+
+	// @75 '/'
+	0x02,
+	0x0C,
+	0x70,
+	0x80,
+	0x00,
+
+	// @80 '0'
+	0x00,
+	0x78,
+	0x84,
+	0x78,
+	0x00,
+
+	// @85 '1'
+	0x04,
+	0x84,
+	0xFC,
+	0x04,
+	0x04,
+
+	// @90 '2'
+	0x00,
+	0x4C,
+	0xB4,
+	0x44,
+	0x00,
+
+	// @95 '3'
+	0x00,
+	0x44,
+	0x94,
+	0x68,
+	0x00,
+
+	// @100 '4'
+	0x00,
+	0x30,
+	0x54,
+	0xFC,
+	0x14,
+
+	// @105 '5'
+	0x00,
+	0xE8,
+	0xA4,
+	0x98,
+	0x00,
+
+	// @110 '6'
+	0x00,
+	0x7C,
+	0xA4,
+	0x98,
+	0x00,
+
+	// @115 '7'
+	0x00,
+	0xC0,
+	0x9C,
+	0xE0,
+	0x00,
+
+	// @120 '8'
+	0x00,
+	0x58,
+	0xA4,
+	0x58,
+	0x00,
+
+	// @125 '9'
+	0x00,
+	0x64,
+	0x94,
+	0xF8,
+	0x00,
+
+	// @130 ':'
+	0x00,
+	0x00,
+	0x24,
+	0x00,
+	0x00,
+
+	// @135 ';'
+	0x00,
+	0x00,
+	0x04,
+	0x28,
+	0x00,
+
+	// @140 '<'
+	0x10,
+	0x10,
+	0x28,
+	0x44,
+	0x00,
+
+	// @145 '='
+	0x00,
+	0x50,
+	0x50,
+	0x50,
+	0x00,
+
+	// @150 '>'
+	0x00,
+	0x44,
+	0x28,
+	0x10,
+	0x10,
+
+	// @155 '?'
+	0x00,
+	0x40,
+	0x94,
+	0x60,
+	0x00,
+
+	// @160 '@'
+	0x00,
+	0x7C,
+	0x82,
+	0x92,
+	0x7A,
+
+	// @165 'A'
+	0x0C,
+	0xB4,
+	0xD0,
+	0x34,
+	0x0C,
+
+	// @170 'B'
+	0x84,
+	0xFC,
+	0xA4,
+	0xA4,
+	0x58,
+
+	// @175 'C'
+	0x00,
+	0xF8,
+	0x84,
+	0xC4,
+	0x00,
+
+	// @180 'D'
+	0x84,
+	0xFC,
+	0x84,
+	0x84,
+	0x78,
+
+	// @185 'E'
+	0x84,
+	0xFC,
+	0xA4,
+	0x84,
+	0xCC,
+
+	// @190 'F'
+	0x84,
+	0xFC,
+	0xA4,
+	0x80,
+	0xC0,
+
+	// @195 'G'
+	0x00,
+	0xF8,
+	0x84,
+	0x9C,
+	0x10,
+
+	// @200 'H'
+	0x84,
+	0xFC,
+	0xA4,
+	0x20,
+	0xFC,
+
+	// @205 'I'
+	0x00,
+	0x84,
+	0xFC,
+	0x84,
+	0x00,
+
+	// @210 'J'
+	0x00,
+	0x18,
+	0x84,
+	0xF8,
+	0x80,
+
+	// @215 'K'
+	0x84,
+	0xFC,
+	0x30,
+	0xDC,
+	0x84,
+
+	// @220 'L'
+	0x84,
+	0xFC,
+	0x84,
+	0x04,
+	0x0C,
+
+	// @225 'M'
+	0xFC,
+	0xE4,
+	0x10,
+	0xE4,
+	0xFC,
+
+	// @230 'N'
+	0x84,
+	0xFC,
+	0x64,
+	0x98,
+	0xFC,
+
+	// @235 'O'
+	0x00,
+	0x78,
+	0x84,
+	0x84,
+	0x78,
+
+	// @240 'P'
+	0x84,
+	0xFC,
+	0x94,
+	0x90,
+	0x60,
+
+	// @245 'Q'
+	0x00,
+	0x78,
+	0x84,
+	0x86,
+	0x7A,
+
+	// @250 'R'
+	0x84,
+	0xFC,
+	0x94,
+	0x90,
+	0x6C,
+
+	// @255 'S'
+	0x00,
+	0xCC,
+	0xA4,
+	0xDC,
+	0x00,
+
+	// @260 'T'
+	0xC0,
+	0x84,
+	0xFC,
+	0x84,
+	0xC0,
+
+	// @265 'U'
+	0x80,
+	0xF8,
+	0x04,
+	0x84,
+	0xF8,
+
+	// @270 'V'
+	0xC0,
+	0xB8,
+	0x04,
+	0x9C,
+	0xE0,
+
+	// @275 'W'
+	0xF8,
+	0x84,
+	0x38,
+	0x84,
+	0xF8,
+
+	// @280 'X'
+	0x84,
+	0xCC,
+	0x30,
+	0xCC,
+	0x84,
+
+	// @285 'Y'
+	0xC0,
+	0xA4,
+	0x1C,
+	0xA4,
+	0xC0,
+
+	// @290 'Z'
+	0x00,
+	0xCC,
+	0x94,
+	0xA4,
+	0xCC,
+
+	// @295 '['
+	0x00,
+	0x00,
+	0xFE,
+	0x82,
+	0x00,
+
+	// @300 '\'
+	0x80,
+	0x60,
+	0x1C,
+	0x02,
+	0x00,
+
+	// @305 ']'
+	0x00,
+	0x82,
+	0xFE,
+	0x00,
+	0x00,
+
+	// @310 '^'
+	0x00,
+	0x20,
+	0xC0,
+	0x20,
+	0x00,
+
+	// @315 '_'
+	0x01,
+	0x01,
+	0x01,
+	0x01,
+	0x01,
+
+	// @320 '`'
+	0x00,
+	0x00,
+	0x80,
+	0x40,
+	0x00,
+
+	// @325 'a'
+	0x00,
+	0x0C,
+	0x2C,
+	0x3C,
+	0x04,
+
+	// @330 'b'
+	0x84,
+	0xFC,
+	0x24,
+	0x24,
+	0x18,
+
+	// @335 'c'
+	0x00,
+	0x3C,
+	0x24,
+	0x24,
+	0x00,
+
+	// @340 'd'
+	0x00,
+	0x18,
+	0x24,
+	0xA4,
+	0xFC,
+
+	// @345 'e'
+	0x00,
+	0x38,
+	0x34,
+	0x34,
+	0x00,
+
+	// @350 'f'
+	0x00,
+	0x24,
+	0x7C,
+	0xA4,
+	0x00,
+
+	// @355 'g'
+	0x00,
+	0x18,
+	0x25,
+	0x25,
+	0x3E,
+
+	// @360 'h'
+	0x84,
+	0xFC,
+	0x24,
+	0x20,
+	0x1C,
+
+	// @365 'i'
+	0x00,
+	0x24,
+	0xBC,
+	0x04,
+	0x00,
+
+	// @370 'j'
+	0x00,
+	0x21,
+	0xA1,
+	0x3F,
+	0x00,
+
+	// @375 'k'
+	0x84,
+	0xFC,
+	0x10,
+	0x3C,
+	0x24,
+
+	// @380 'l'
+	0x00,
+	0x84,
+	0xFC,
+	0x04,
+	0x00,
+
+	// @385 'm'
+	0x3C,
+	0x20,
+	0x1C,
+	0x20,
+	0x1C,
+
+	// @390 'n'
+	0x24,
+	0x3C,
+	0x20,
+	0x20,
+	0x1C,
+
+	// @395 'o'
+	0x00,
+	0x18,
+	0x24,
+	0x24,
+	0x18,
+
+	// @400 'p'
+	0x21,
+	0x3F,
+	0x25,
+	0x24,
+	0x18,
+
+	// @405 'q'
+	0x00,
+	0x18,
+	0x24,
+	0x25,
+	0x3F,
+
+	// @410 'r'
+	0x00,
+	0x24,
+	0x3C,
+	0x24,
+	0x20,
+
+	// @415 's'
+	0x00,
+	0x04,
+	0x34,
+	0x28,
+	0x00,
+
+	// @420 't'
+	0x20,
+	0x78,
+	0x24,
+	0x24,
+	0x08,
+
+	// @425 'u'
+	0x20,
+	0x38,
+	0x04,
+	0x24,
+	0x3C,
+
+	// @430 'v'
+	0x20,
+	0x30,
+	0x0C,
+	0x0C,
+	0x30,
+
+	// @435 'w'
+	0x38,
+	0x24,
+	0x18,
+	0x24,
+	0x38,
+
+	// @440 'x'
+	0x00,
+	0x24,
+	0x18,
+	0x18,
+	0x24,
+
+	// @445 'y'
+	0x20,
+	0x39,
+	0x07,
+	0x38,
+	0x20,
+
+	// @450 'z'
+	0x00,
+	0x34,
+	0x2C,
+	0x34,
+	0x2C,
+
+	// @455 '{'
+	0x00,
+	0x10,
+	0x7C,
+	0x82,
+	0x00,
+
+	// @460 '|'
+	0x00,
+	0x00,
+	0xFE,
+	0x00,
+	0x00,
+
+	// @465 '}'
+	0x00,
+	0x82,
+	0x7C,
+	0x10,
+	0x00,
+
+	// @470 '~'
+	0x00,
+	0x08,
+	0x10,
+	0x08,
+	0x10,
+};
+
+// 7x12: 95 glyphs x 7 columns x 2 bytes
+const uint8_t Font12_TableRot[] PROGMEM =
+{
+	// @0 ' '
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @14 '!'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x7C, 0x80,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @28 '"'
+	0x00, 0x00,
+	0x70, 0x00,
+	0x40, 0x00,
+	0x00, 0x00,
+	0x70, 0x00,
+	0x40, 0x00,
+	0x00, 0x00,
+
+	// @42 '#'
+	0x00, 0x00,
+	0x0A, 0xC0,
+	0x1F, 0x00,
+	0x6A, 0xC0,
+	0x1F, 0x00,
+	0x6A, 0x00,
+	0x00, 0x00,
+
+	// @56 '$'
+	0x00, 0x00,
+	0x1B, 0x00,
+	0x25, 0x00,
+	0x65, 0xC0,
+	0x26, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @70 '%'
+	0x00, 0x00,
+	0x24, 0x00,
+	0x54, 0x00,
+	0x25, 0x00,
+	0x0A, 0x80,
+	0x09, 0x00,
+	0x00, 0x00,
+
+	// @84 '&'
+	0x00, 0x00,
+	0x03, 0x00,
+	0x0C, 0x80,
+	0x12, 0x80,
+	0x11, 0x00,
+	0x02, 0x80,
+	0x00, 0x00,
+
+	// @98 '''
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x78, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @112 '('
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x1F, 0x80,
+	0x60, 0x60,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @126 ')'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x60, 0x60,
+	0x1F, 0x80,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @140 '*'
+	0x00, 0x00,
+	0x20, 0x00,
+	0x2C, 0x00,
+	0x70, 0x00,
+	0x2C, 0x00,
+	0x20, 0x00,
+	0x00, 0x00,
+
+	// @154 '+'
+	0x04, 0x00,
+	0x04, 0x00,
+	0x04, 0x00,
+	0x3F, 0x80,
+	0x04, 0x00,
+	0x04, 0x00,
+	0x04, 0x00,
+
+	// @168 ','
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x60,
+	0x01, 0xC0,
+	0x01, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @182 '-'
+	0x00, 0x00,
+	0x04, 0x00,
+	0x04, 0x00,
+	0x04, 0x00,
+	0x04, 0x00,
+	0x04, 0x00,
+	0x00, 0x00,
+
+	// @196 '.'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x01, 0x80,
+	0x01, 0x80,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @210 '/'
+	0x00, 0x00,
+	0x00, 0x40,
+	0x01, 0x80,
+	0x06, 0x00,
+	0x18, 0x00,
+	0x60, 0x00,
+	0x00, 0x00,
+
+	// @224 '0'
+	0x00, 0x00,
+	0x3F, 0x00,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x3F, 0x00,
+	0x00, 0x00,
+
+	// @238 '1'
+	0x00, 0x00,
+	0x00, 0x80,
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x00, 0x80,
+	0x00, 0x80,
+	0x00, 0x00,
+
+	// @252 '2'
+	0x00, 0x00,
+	0x21, 0x80,
+	0x42, 0x80,
+	0x44, 0x80,
+	0x48, 0x80,
+	0x31, 0x80,
+	0x00, 0x00,
+
+	// @266 '3'
+	0x00, 0x00,
+	0x21, 0x00,
+	0x40, 0x80,
+	0x48, 0x80,
+	0x48, 0x80,
+	0x37, 0x00,
+	0x00, 0x00,
+
+	// @280 '4'
+	0x00, 0x00,
+	0x06, 0x00,
+	0x0A, 0x00,
+	0x32, 0x00,
+	0x42, 0x80,
+	0x7F, 0x80,
+	0x02, 0x80,
+
+	// @294 '5'
+	0x00, 0x00,
+	0x01, 0x00,
+	0x78, 0x80,
+	0x48, 0x80,
+	0x48, 0x80,
+	0x47, 0x00,
+	0x00, 0x00,
+
+	// @308 '6'
+	0x00, 0x00,
+	0x1F, 0x00,
+	0x28, 0x80,
+	0x48, 0x80,
+	0x48, 0x80,
+	0x47, 0x00,
+	0x00, 0x00,
+
+	// @322 '7'
+	0x00, 0x00,
+	0x60, 0x00,
+	0x40, 0x00,
+	0x41, 0x80,
+	0x4E, 0x00,
+	0x70, 0x00,
+	0x00, 0x00,
+
+	// @336 '8'
+	0x00, 0x00,
+	0x37, 0x00,
+	0x48, 0x80,
+	0x48, 0x80,
+	0x48, 0x80,
+	0x37, 0x00,
+	0x00, 0x00,
+
+	// @350 '9'
+	0x00, 0x00,
+	0x38, 0x80,
+	0x44, 0x80,
+	0x44, 0x80,
+	0x45, 0x00,
+	0x3E, 0x00,
+	0x00, 0x00,
+
+	// @364 ':'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x19, 0x80,
+	0x19, 0x80,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @378 ';'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0xC0,
+	0x19, 0x80,
+	0x19, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @392 '<'
+	0x04, 0x00,
+	0x0A, 0x00,
+	0x0A, 0x00,
+	0x11, 0x00,
+	0x20, 0x80,
+	0x20, 0x80,
+	0x00, 0x00,
+
+	// @406 '='
+	0x00, 0x00,
+	0x0A, 0x00,
+	0x0A, 0x00,
+	0x0A, 0x00,
+	0x0A, 0x00,
+	0x0A, 0x00,
+	0x00, 0x00,
+
+	// @420 '>'
+	0x20, 0x80,
+	0x20, 0x80,
+	0x11, 0x00,
+	0x0A, 0x00,
+	0x0A, 0x00,
+	0x04, 0x00,
+	0x00, 0x00,
+
+	// @434 '?'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x10, 0x80,
+	0x22, 0x80,
+	0x24, 0x00,
+	0x18, 0x00,
+	0x00, 0x00,
+
+	// @448 '@'
+	0x00, 0x00,
+	0x7F, 0x80,
+	0x80, 0x40,
+	0x8C, 0x40,
+	0x92, 0x40,
+	0x7E, 0x80,
+	0x00, 0x00,
+
+	// @462 'A'
+	0x00, 0x80,
+	0x03, 0x80,
+	0x5E, 0x80,
+	0x62, 0x00,
+	0x1E, 0x80,
+	0x03, 0x80,
+	0x00, 0x80,
+
+	// @476 'B'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x48, 0x80,
+	0x48, 0x80,
+	0x48, 0x80,
+	0x37, 0x00,
+	0x00, 0x00,
+
+	// @490 'C'
+	0x00, 0x00,
+	0x3F, 0x00,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x61, 0x00,
+	0x00, 0x00,
+
+	// @504 'D'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x21, 0x00,
+	0x1E, 0x00,
+	0x00, 0x00,
+
+	// @518 'E'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x48, 0x80,
+	0x5C, 0x80,
+	0x40, 0x80,
+	0x61, 0x80,
+	0x00, 0x00,
+
+	// @532 'F'
+	0x00, 0x00,
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x48, 0x80,
+	0x5C, 0x00,
+	0x40, 0x00,
+	0x60, 0x00,
+
+	// @546 'G'
+	0x00, 0x00,
+	0x3F, 0x00,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x44, 0x80,
+	0x67, 0x00,
+	0x04, 0x00,
+
+	// @560 'H'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x48, 0x80,
+	0x08, 0x00,
+	0x48, 0x80,
+	0x7F, 0x80,
+	0x40, 0x80,
+
+	// @574 'I'
+	0x00, 0x00,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x00, 0x00,
+
+	// @588 'J'
+	0x00, 0x00,
+	0x07, 0x00,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x7F, 0x00,
+	0x40, 0x00,
+	0x00, 0x00,
+
+	// @602 'K'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x44, 0x80,
+	0x0C, 0x00,
+	0x52, 0x00,
+	0x61, 0x80,
+	0x40, 0x80,
+
+	// @616 'L'
+	0x00, 0x00,
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x40, 0x80,
+	0x00, 0x80,
+	0x03, 0x80,
+	0x00, 0x00,
+
+	// @630 'M'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x70, 0x80,
+	0x0C, 0x00,
+	0x70, 0x80,
+	0x7F, 0x80,
+	0x40, 0x80,
+
+	// @644 'N'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x70, 0x80,
+	0x0E, 0x00,
+	0x41, 0x80,
+	0x7F, 0x80,
+	0x40, 0x00,
+
+	// @658 'O'
+	0x00, 0x00,
+	0x3F, 0x00,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x40, 0x80,
+	0x3F, 0x00,
+	0x00, 0x00,
+
+	// @672 'P'
+	0x00, 0x00,
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x44, 0x80,
+	0x44, 0x00,
+	0x38, 0x00,
+	0x00, 0x00,
+
+	// @686 'Q'
+	0x00, 0x00,
+	0x3F, 0x00,
+	0x40, 0x80,
+	0x40, 0xC0,
+	0x40, 0xC0,
+	0x3F, 0x40,
+	0x00, 0x00,
+
+	// @700 'R'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x44, 0x80,
+	0x44, 0x00,
+	0x46, 0x00,
+	0x39, 0x00,
+	0x00, 0x80,
+
+	// @714 'S'
+	0x00, 0x00,
+	0x31, 0x80,
+	0x49, 0x00,
+	0x48, 0x80,
+	0x28, 0x80,
+	0x67, 0x00,
+	0x00, 0x00,
+
+	// @728 'T'
+	0x60, 0x00,
+	0x40, 0x00,
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x40, 0x80,
+	0x40, 0x00,
+	0x60, 0x00,
+
+	// @742 'U'
+	0x40, 0x00,
+	0x7F, 0x00,
+	0x40, 0x80,
+	0x00, 0x80,
+	0x40, 0x80,
+	0x7F, 0x00,
+	0x40, 0x00,
+
+	// @756 'V'
+	0x40, 0x00,
+	0x70, 0x00,
+	0x4E, 0x00,
+	0x01, 0x80,
+	0x4E, 0x00,
+	0x70, 0x00,
+	0x40, 0x00,
+
+	// @770 'W'
+	0x40, 0x00,
+	0x7F, 0x00,
+	0x40, 0x80,
+	0x0F, 0x00,
+	0x40, 0x80,
+	0x7F, 0x00,
+	0x40, 0x00,
+
+	// @784 'X'
+	0x40, 0x80,
+	0x61, 0x80,
+	0x12, 0x00,
+	0x0C, 0x00,
+	0x12, 0x00,
+	0x61, 0x80,
+	0x40, 0x80,
+
+	// @798 'Y'
+	0x40, 0x00,
+	0x60, 0x00,
+	0x58, 0x80,
+	0x07, 0x80,
+	0x58, 0x80,
+	0x60, 0x00,
+	0x40, 0x00,
+
+	// @812 'Z'
+	0x00, 0x00,
+	0x61, 0x80,
+	0x42, 0x80,
+	0x4C, 0x80,
+	0x50, 0x80,
+	0x61, 0x80,
+	0x00, 0x00,
+
+	// @826 '['
+	0x00, 0x00,
+	0x00, 0x00,
+	0x7F, 0xE0,
+	0x40, 0x20,
+	0x40, 0x20,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @840 '\'
+	0x00, 0x00,
+	0x40, 0x00,
+	0x38, 0x00,
+	0x06, 0x00,
+	0x01, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @854 ']'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x40, 0x20,
+	0x40, 0x20,
+	0x7F, 0xE0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @868 '^'
+	0x00, 0x00,
+	0x08, 0x00,
+	0x10, 0x00,
+	0x60, 0x00,
+	0x10, 0x00,
+	0x08, 0x00,
+	0x00, 0x00,
+
+	// @882 '_'
+	0x00, 0x10,
+	0x00, 0x10,
+	0x00, 0x10,
+	0x00, 0x10,
+	0x00, 0x10,
+	0x00, 0x10,
+	0x00, 0x10,
+
+	// @896 '`'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x40, 0x00,
+	0x20, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @910 'a'
+	0x00, 0x00,
+	0x0B, 0x00,
+	0x14, 0x80,
+	0x14, 0x80,
+	0x14, 0x80,
+	0x0F, 0x80,
+	0x00, 0x80,
+
+	// @924 'b'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x08, 0x80,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x0F, 0x00,
+	0x00, 0x00,
+
+	// @938 'c'
+	0x00, 0x00,
+	0x0F, 0x00,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x19, 0x00,
+	0x00, 0x00,
+
+	// @952 'd'
+	0x00, 0x00,
+	0x0F, 0x00,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x48, 0x80,
+	0x7F, 0x80,
+	0x00, 0x80,
+
+	// @966 'e'
+	0x00, 0x00,
+	0x0F, 0x00,
+	0x14, 0x80,
+	0x14, 0x80,
+	0x14, 0x80,
+	0x0C, 0x80,
+	0x00, 0x00,
+
+	// @980 'f'
+	0x00, 0x00,
+	0x10, 0x80,
+	0x3F, 0x80,
+	0x50, 0x80,
+	0x50, 0x80,
+	0x50, 0x80,
+	0x00, 0x00,
+
+	// @994 'g'
+	0x00, 0x00,
+	0x0F, 0x00,
+	0x10, 0xA0,
+	0x10, 0xA0,
+	0x08, 0xA0,
+	0x1F, 0xC0,
+	0x10, 0x00,
+
+	// @1008 'h'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x08, 0x80,
+	0x10, 0x00,
+	0x10, 0x80,
+	0x0F, 0x80,
+	0x00, 0x80,
+
+	// @1022 'i'
+	0x00, 0x00,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x5F, 0x80,
+	0x00, 0x80,
+	0x00, 0x80,
+	0x00, 0x00,
+
+	// @1036 'j'
+	0x00, 0x00,
+	0x10, 0x20,
+	0x10, 0x20,
+	0x50, 0x20,
+	0x1F, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1050 'k'
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x04, 0x00,
+	0x16, 0x80,
+	0x19, 0x80,
+	0x10, 0x80,
+	0x00, 0x00,
+
+	// @1064 'l'
+	0x00, 0x00,
+	0x00, 0x80,
+	0x40, 0x80,
+	0x7F, 0x80,
+	0x00, 0x80,
+	0x00, 0x80,
+	0x00, 0x00,
+
+	// @1078 'm'
+	0x10, 0x80,
+	0x1F, 0x80,
+	0x10, 0x80,
+	0x0F, 0x80,
+	0x10, 0x80,
+	0x0F, 0x80,
+	0x00, 0x80,
+
+	// @1092 'n'
+	0x10, 0x80,
+	0x1F, 0x80,
+	0x08, 0x80,
+	0x10, 0x00,
+	0x10, 0x80,
+	0x0F, 0x80,
+	0x00, 0x80,
+
+	// @1106 'o'
+	0x00, 0x00,
+	0x0F, 0x00,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x0F, 0x00,
+	0x00, 0x00,
+
+	// @1120 'p'
+	0x10, 0x20,
+	0x1F, 0xE0,
+	0x08, 0xA0,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x0F, 0x00,
+	0x00, 0x00,
+
+	// @1134 'q'
+	0x00, 0x00,
+	0x0F, 0x00,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x08, 0xA0,
+	0x1F, 0xE0,
+	0x10, 0x20,
+
+	// @1148 'r'
+	0x00, 0x00,
+	0x10, 0x80,
+	0x1F, 0x80,
+	0x08, 0x80,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x00, 0x00,
+
+	// @1162 's'
+	0x00, 0x00,
+	0x09, 0x80,
+	0x14, 0x80,
+	0x14, 0x80,
+	0x14, 0x80,
+	0x1B, 0x00,
+	0x00, 0x00,
+
+	// @1176 't'
+	0x00, 0x00,
+	0x10, 0x00,
+	0x3F, 0x00,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x10, 0x80,
+	0x01, 0x00,
+
+	// @1190 'u'
+	0x10, 0x00,
+	0x1F, 0x00,
+	0x00, 0x80,
+	0x00, 0x80,
+	0x11, 0x00,
+	0x1F, 0x80,
+	0x00, 0x80,
+
+	// @1204 'v'
+	0x10, 0x00,
+	0x1C, 0x00,
+	0x13, 0x00,
+	0x00, 0x80,
+	0x13, 0x00,
+	0x1C, 0x00,
+	0x10, 0x00,
+
+	// @1218 'w'
+	0x10, 0x00,
+	0x1F, 0x00,
+	0x10, 0x80,
+	0x07, 0x00,
+	0x10, 0x80,
+	0x1F, 0x00,
+	0x10, 0x00,
+
+	// @1232 'x'
+	0x10, 0x80,
+	0x19, 0x80,
+	0x06, 0x00,
+	0x06, 0x00,
+	0x19, 0x80,
+	0x10, 0x80,
+	0x00, 0x00,
+
+	// @1246 'y'
+	0x10, 0x00,
+	0x18, 0x20,
+	0x16, 0x20,
+	0x01, 0xE0,
+	0x13, 0x20,
+	0x1C, 0x00,
+	0x10, 0x00,
+
+	// @1260 'z'
+	0x00, 0x00,
+	0x19, 0x80,
+	0x12, 0x80,
+	0x14, 0x80,
+	0x18, 0x80,
+	0x11, 0x80,
+	0x00, 0x00,
+
+	// @1274 '{'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x02, 0x00,
+	0x3D, 0xC0,
+	0x40, 0x20,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1288 '|'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x7F, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1302 '}'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x40, 0x20,
+	0x3D, 0xC0,
+	0x02, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1316 '~'
+	0x00, 0x00,
+	0x02, 0x00,
+	0x04, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x04, 0x00,
+	0x00, 0x00,
+};
+
+// 11x16: 95 glyphs x 11 columns x 2 bytes
+const uint8_t Font16_TableRot[] PROGMEM =
+{
+	// @0 ' '
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @22 '!'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x7F, 0xA0,
+	0x7F, 0xA0,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @44 '"'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x30, 0x00,
+	0x3E, 0x00,
+	0x30, 0x00,
+	0x00, 0x00,
+	0x30, 0x00,
+	0x3E, 0x00,
+	0x30, 0x00,
+	0x00, 0x00,
+
+	// @66 '#'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x05, 0x00,
+	0x07, 0xF0,
+	0x7F, 0xF0,
+	0x7D, 0x00,
+	0x07, 0xF0,
+	0x7F, 0xF0,
+	0x7D, 0x00,
+	0x05, 0x00,
+	0x00, 0x00,
+
+	// @88 '$'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x38, 0xE0,
+	0x7C, 0xE0,
+	0x4E, 0x20,
+	0xC6, 0x38,
+	0x47, 0x20,
+	0x73, 0xE0,
+	0x71, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @110 '%'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x31, 0x00,
+	0x4B, 0x00,
+	0x4A, 0x00,
+	0x36, 0x00,
+	0x06, 0xC0,
+	0x05, 0x20,
+	0x0D, 0x20,
+	0x08, 0xC0,
+	0x00, 0x00,
+
+	// @132 '&'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0xC0,
+	0x1D, 0xE0,
+	0x3F, 0x20,
+	0x23, 0xA0,
+	0x20, 0xC0,
+	0x21, 0xE0,
+	0x01, 0x20,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @154 '''
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x30, 0x00,
+	0x3E, 0x00,
+	0x30, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @176 '('
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x0F, 0xC0,
+	0x1F, 0xE0,
+	0x78, 0x78,
+	0x60, 0x18,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @198 ')'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x60, 0x18,
+	0x70, 0x38,
+	0x1F, 0xF0,
+	0x0F, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @220 '*'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x18, 0x00,
+	0x1B, 0x00,
+	0x1F, 0x00,
+	0x7E, 0x00,
+	0x7E, 0x00,
+	0x1F, 0x00,
+	0x1B, 0x00,
+	0x18, 0x00,
+	0x00, 0x00,
+
+	// @242 '+'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x1F, 0xC0,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @264 ','
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x1C,
+	0x00, 0x70,
+	0x00, 0x40,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @286 '-'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @308 '.'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x60,
+	0x00, 0x60,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @330 '/'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x18,
+	0x00, 0x78,
+	0x01, 0xE0,
+	0x03, 0x80,
+	0x0E, 0x00,
+	0x3C, 0x00,
+	0xF0, 0x00,
+	0xC0, 0x00,
+	0x00, 0x00,
+
+	// @352 '0'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x1F, 0x80,
+	0x3F, 0xC0,
+	0x60, 0x60,
+	0x40, 0x20,
+	0x60, 0x60,
+	0x3F, 0xC0,
+	0x1F, 0x80,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @374 '1'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x7F, 0xE0,
+	0x7F, 0xE0,
+	0x00, 0x20,
+	0x00, 0x20,
+	0x00, 0x20,
+	0x00, 0x00,
+
+	// @396 '2'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x18, 0x60,
+	0x38, 0xE0,
+	0x61, 0xA0,
+	0x43, 0x20,
+	0x46, 0x20,
+	0x7C, 0x20,
+	0x38, 0x20,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @418 '3'
+	0x00, 0x00,
+	0x20, 0x40,
+	0x60, 0x60,
+	0x44, 0x20,
+	0x44, 0x20,
+	0x44, 0x20,
+	0x4E, 0x20,
+	0x7F, 0xE0,
+	0x33, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @440 '4'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x01, 0x80,
+	0x07, 0x80,
+	0x1C, 0xA0,
+	0x70, 0xA0,
+	0x7F, 0xE0,
+	0x7F, 0xE0,
+	0x00, 0xA0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @462 '5'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x40,
+	0x7E, 0x20,
+	0x7C, 0x20,
+	0x44, 0x20,
+	0x44, 0x20,
+	0x47, 0xE0,
+	0x43, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @484 '6'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x0F, 0x80,
+	0x3F, 0xC0,
+	0x32, 0x60,
+	0x64, 0x20,
+	0x44, 0x20,
+	0x47, 0xE0,
+	0x43, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @506 '7'
+	0x00, 0x00,
+	0x60, 0x00,
+	0x40, 0x00,
+	0x40, 0x00,
+	0x40, 0xE0,
+	0x4F, 0xE0,
+	0x7F, 0x00,
+	0x70, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @528 '8'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x3B, 0xC0,
+	0x7F, 0xE0,
+	0x44, 0x20,
+	0x44, 0x20,
+	0x44, 0x20,
+	0x7F, 0xE0,
+	0x3B, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @550 '9'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x3C, 0x20,
+	0x7E, 0x20,
+	0x42, 0x20,
+	0x42, 0x60,
+	0x64, 0xC0,
+	0x3F, 0xC0,
+	0x1F, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @572 ':'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x0C, 0x60,
+	0x0C, 0x60,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @594 ';'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x18,
+	0x00, 0x60,
+	0x0C, 0x40,
+	0x0C, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @616 '<'
+	0x00, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x05, 0x00,
+	0x05, 0x00,
+	0x08, 0x80,
+	0x10, 0x40,
+	0x10, 0x40,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x00, 0x00,
+
+	// @638 '='
+	0x00, 0x00,
+	0x05, 0x00,
+	0x05, 0x00,
+	0x05, 0x00,
+	0x05, 0x00,
+	0x05, 0x00,
+	0x05, 0x00,
+	0x05, 0x00,
+	0x05, 0x00,
+	0x05, 0x00,
+	0x00, 0x00,
+
+	// @660 '>'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x10, 0x40,
+	0x10, 0x40,
+	0x08, 0x80,
+	0x05, 0x00,
+	0x05, 0x00,
+	0x02, 0x00,
+	0x02, 0x00,
+	0x00, 0x00,
+
+	// @682 '?'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x18, 0x00,
+	0x38, 0x00,
+	0x21, 0xA0,
+	0x23, 0xA0,
+	0x22, 0x00,
+	0x3E, 0x00,
+	0x1C, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @704 '@'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x1F, 0xC0,
+	0x20, 0x20,
+	0x43, 0x10,
+	0x44, 0x90,
+	0x44, 0x90,
+	0x3F, 0xA0,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @726 'A'
+	0x00, 0x00,
+	0x00, 0x20,
+	0x20, 0xE0,
+	0x27, 0xE0,
+	0x3F, 0x20,
+	0x31, 0x00,
+	0x31, 0x00,
+	0x3F, 0x20,
+	0x07, 0xE0,
+	0x00, 0xE0,
+	0x00, 0x20,
+
+	// @748 'B'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x22, 0x20,
+	0x22, 0x20,
+	0x22, 0x20,
+	0x3F, 0xE0,
+	0x1D, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @770 'C'
+	0x00, 0x00,
+	0x0F, 0x80,
+	0x1F, 0xC0,
+	0x30, 0x60,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x10, 0x40,
+	0x38, 0x80,
+	0x00, 0x00,
+
+	// @792 'D'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x30, 0x60,
+	0x1F, 0xC0,
+	0x0F, 0x80,
+	0x00, 0x00,
+
+	// @814 'E'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x22, 0x20,
+	0x22, 0x20,
+	0x27, 0x20,
+	0x20, 0x20,
+	0x38, 0xE0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @836 'F'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x22, 0x20,
+	0x22, 0x20,
+	0x27, 0x00,
+	0x20, 0x00,
+	0x20, 0x00,
+	0x38, 0x00,
+	0x00, 0x00,
+
+	// @858 'G'
+	0x00, 0x00,
+	0x0F, 0x80,
+	0x1F, 0xC0,
+	0x30, 0x60,
+	0x20, 0x20,
+	0x21, 0x20,
+	0x21, 0x20,
+	0x11, 0xE0,
+	0x39, 0xC0,
+	0x01, 0x00,
+	0x00, 0x00,
+
+	// @880 'H'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x22, 0x20,
+	0x02, 0x00,
+	0x22, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x20, 0x20,
+	0x00, 0x00,
+
+	// @902 'I'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x00, 0x00,
+
+	// @924 'J'
+	0x00, 0x00,
+	0x01, 0xC0,
+	0x01, 0xE0,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xC0,
+	0x20, 0x00,
+	0x20, 0x00,
+	0x00, 0x00,
+
+	// @946 'K'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x23, 0x20,
+	0x07, 0x00,
+	0x2D, 0x80,
+	0x38, 0xE0,
+	0x30, 0x60,
+	0x20, 0x20,
+	0x00, 0x00,
+
+	// @968 'L'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x00, 0x20,
+	0x00, 0x20,
+	0x01, 0xE0,
+	0x00, 0x00,
+
+	// @990 'M'
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x0C, 0x20,
+	0x07, 0x20,
+	0x01, 0x80,
+	0x07, 0x20,
+	0x0C, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x20, 0x20,
+
+	// @1012 'N'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x0C, 0x20,
+	0x07, 0x00,
+	0x21, 0x80,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x20, 0x00,
+	0x00, 0x00,
+
+	// @1034 'O'
+	0x00, 0x00,
+	0x0F, 0x80,
+	0x1F, 0xC0,
+	0x30, 0x60,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x30, 0x60,
+	0x1F, 0xC0,
+	0x0F, 0x80,
+	0x00, 0x00,
+
+	// @1056 'P'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x21, 0x20,
+	0x21, 0x20,
+	0x21, 0x20,
+	0x3F, 0x00,
+	0x1E, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1078 'Q'
+	0x00, 0x00,
+	0x0F, 0x80,
+	0x1F, 0xC0,
+	0x30, 0x68,
+	0x20, 0x38,
+	0x20, 0x38,
+	0x20, 0x28,
+	0x30, 0x68,
+	0x1F, 0xD8,
+	0x0F, 0x90,
+	0x00, 0x00,
+
+	// @1100 'R'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x22, 0x20,
+	0x22, 0x20,
+	0x23, 0x00,
+	0x3D, 0xC0,
+	0x1C, 0xE0,
+	0x00, 0x20,
+	0x00, 0x20,
+
+	// @1122 'S'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x1C, 0xE0,
+	0x3E, 0xE0,
+	0x26, 0x20,
+	0x22, 0x20,
+	0x23, 0x20,
+	0x3B, 0xE0,
+	0x39, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1144 'T'
+	0x00, 0x00,
+	0x3C, 0x00,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xE0,
+	0x20, 0x20,
+	0x20, 0x20,
+	0x3C, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1166 'U'
+	0x00, 0x00,
+	0x20, 0x00,
+	0x3F, 0xC0,
+	0x3F, 0xE0,
+	0x20, 0x20,
+	0x00, 0x20,
+	0x20, 0x20,
+	0x3F, 0xE0,
+	0x3F, 0xC0,
+	0x20, 0x00,
+	0x00, 0x00,
+
+	// @1188 'V'
+	0x00, 0x00,
+	0x20, 0x00,
+	0x38, 0x00,
+	0x3F, 0x00,
+	0x27, 0xE0,
+	0x00, 0x60,
+	0x27, 0xE0,
+	0x3F, 0x00,
+	0x38, 0x00,
+	0x20, 0x00,
+	0x00, 0x00,
+
+	// @1210 'W'
+	0x20, 0x00,
+	0x3E, 0x00,
+	0x3F, 0xE0,
+	0x20, 0xE0,
+	0x27, 0xC0,
+	0x0E, 0x00,
+	0x27, 0xC0,
+	0x20, 0xE0,
+	0x3F, 0xE0,
+	0x3E, 0x00,
+	0x20, 0x00,
+
+	// @1232 'X'
+	0x00, 0x00,
+	0x20, 0x20,
+	0x30, 0x60,
+	0x38, 0xE0,
+	0x2F, 0xA0,
+	0x07, 0x00,
+	0x2F, 0xA0,
+	0x38, 0xE0,
+	0x30, 0x60,
+	0x20, 0x20,
+	0x00, 0x00,
+
+	// @1254 'Y'
+	0x00, 0x00,
+	0x20, 0x00,
+	0x30, 0x00,
+	0x38, 0x20,
+	0x2C, 0x20,
+	0x07, 0xE0,
+	0x07, 0xE0,
+	0x2C, 0x20,
+	0x38, 0x20,
+	0x30, 0x00,
+	0x20, 0x00,
+
+	// @1276 'Z'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x38, 0x60,
+	0x20, 0xE0,
+	0x21, 0xA0,
+	0x27, 0x20,
+	0x2C, 0x20,
+	0x38, 0x20,
+	0x30, 0xE0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1298 '['
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x7F, 0xF8,
+	0x7F, 0xF8,
+	0x40, 0x08,
+	0x40, 0x08,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1320 '\'
+	0x00, 0x00,
+	0x00, 0x00,
+	0xC0, 0x00,
+	0xF0, 0x00,
+	0x3C, 0x00,
+	0x0E, 0x00,
+	0x03, 0x80,
+	0x01, 0xE0,
+	0x00, 0x78,
+	0x00, 0x18,
+	0x00, 0x00,
+
+	// @1342 ']'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x40, 0x08,
+	0x40, 0x08,
+	0x7F, 0xF8,
+	0x7F, 0xF8,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1364 '^'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x0C, 0x00,
+	0x10, 0x00,
+	0x60, 0x00,
+	0x80, 0x00,
+	0x60, 0x00,
+	0x10, 0x00,
+	0x0C, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1386 '_'
+	0x00, 0x01,
+	0x00, 0x01,
+	0x00, 0x01,
+	0x00, 0x01,
+	0x00, 0x01,
+	0x00, 0x01,
+	0x00, 0x01,
+	0x00, 0x01,
+	0x00, 0x01,
+	0x00, 0x01,
+	0x00, 0x01,
+
+	// @1408 '`'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x80, 0x00,
+	0x40, 0x00,
+	0x20, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1430 'a'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0xC0,
+	0x09, 0xE0,
+	0x09, 0x20,
+	0x09, 0x20,
+	0x09, 0x40,
+	0x0F, 0xE0,
+	0x07, 0xE0,
+	0x00, 0x20,
+	0x00, 0x00,
+
+	// @1452 'b'
+	0x00, 0x00,
+	0x40, 0x20,
+	0x7F, 0xE0,
+	0x7F, 0xE0,
+	0x04, 0x40,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x0C, 0x60,
+	0x07, 0xC0,
+	0x03, 0x80,
+	0x00, 0x00,
+
+	// @1474 'c'
+	0x00, 0x00,
+	0x03, 0x80,
+	0x07, 0xC0,
+	0x0C, 0x60,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x04, 0x60,
+	0x0E, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1496 'd'
+	0x00, 0x00,
+	0x03, 0x80,
+	0x07, 0xC0,
+	0x0C, 0x60,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x44, 0x40,
+	0x7F, 0xE0,
+	0x7F, 0xE0,
+	0x00, 0x20,
+	0x00, 0x00,
+
+	// @1518 'e'
+	0x00, 0x00,
+	0x03, 0x80,
+	0x07, 0xC0,
+	0x0D, 0x60,
+	0x09, 0x20,
+	0x09, 0x20,
+	0x09, 0x20,
+	0x0D, 0x20,
+	0x07, 0x60,
+	0x03, 0x40,
+	0x00, 0x00,
+
+	// @1540 'f'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x3F, 0xE0,
+	0x7F, 0xE0,
+	0x48, 0x20,
+	0x48, 0x20,
+	0x48, 0x20,
+	0x40, 0x00,
+	0x40, 0x00,
+
+	// @1562 'g'
+	0x00, 0x00,
+	0x03, 0x80,
+	0x07, 0xC0,
+	0x0C, 0x64,
+	0x08, 0x24,
+	0x08, 0x24,
+	0x04, 0x44,
+	0x0F, 0xFC,
+	0x0F, 0xF8,
+	0x08, 0x00,
+	0x00, 0x00,
+
+	// @1584 'h'
+	0x00, 0x00,
+	0x40, 0x20,
+	0x7F, 0xE0,
+	0x7F, 0xE0,
+	0x04, 0x20,
+	0x08, 0x00,
+	0x08, 0x20,
+	0x0F, 0xE0,
+	0x07, 0xE0,
+	0x00, 0x20,
+	0x00, 0x00,
+
+	// @1606 'i'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x20,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x6F, 0xE0,
+	0x6F, 0xE0,
+	0x00, 0x20,
+	0x00, 0x20,
+	0x00, 0x20,
+	0x00, 0x00,
+
+	// @1628 'j'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x08, 0x04,
+	0x08, 0x04,
+	0x08, 0x04,
+	0x68, 0x04,
+	0x6F, 0xFC,
+	0x0F, 0xF8,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1650 'k'
+	0x00, 0x00,
+	0x40, 0x20,
+	0x7F, 0xE0,
+	0x7F, 0xE0,
+	0x03, 0x00,
+	0x0F, 0xA0,
+	0x0C, 0xE0,
+	0x08, 0x60,
+	0x08, 0x20,
+	0x00, 0x20,
+	0x00, 0x00,
+
+	// @1672 'l'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x20,
+	0x40, 0x20,
+	0x40, 0x20,
+	0x7F, 0xE0,
+	0x7F, 0xE0,
+	0x00, 0x20,
+	0x00, 0x20,
+	0x00, 0x20,
+	0x00, 0x00,
+
+	// @1694 'm'
+	0x00, 0x00,
+	0x08, 0x20,
+	0x0F, 0xE0,
+	0x0F, 0xE0,
+	0x08, 0x00,
+	0x0F, 0xE0,
+	0x0F, 0xE0,
+	0x08, 0x00,
+	0x0F, 0xE0,
+	0x07, 0xE0,
+	0x00, 0x20,
+
+	// @1716 'n'
+	0x00, 0x00,
+	0x08, 0x20,
+	0x0F, 0xE0,
+	0x0F, 0xE0,
+	0x04, 0x20,
+	0x08, 0x00,
+	0x08, 0x20,
+	0x0F, 0xE0,
+	0x07, 0xE0,
+	0x00, 0x20,
+	0x00, 0x00,
+
+	// @1738 'o'
+	0x00, 0x00,
+	0x03, 0x80,
+	0x07, 0xC0,
+	0x0C, 0x60,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x0C, 0x60,
+	0x07, 0xC0,
+	0x03, 0x80,
+	0x00, 0x00,
+
+	// @1760 'p'
+	0x00, 0x00,
+	0x08, 0x04,
+	0x0F, 0xFC,
+	0x0F, 0xFC,
+	0x04, 0x44,
+	0x08, 0x24,
+	0x08, 0x20,
+	0x0C, 0x60,
+	0x07, 0xC0,
+	0x03, 0x80,
+	0x00, 0x00,
+
+	// @1782 'q'
+	0x00, 0x00,
+	0x03, 0x80,
+	0x07, 0xC0,
+	0x0C, 0x60,
+	0x08, 0x20,
+	0x08, 0x24,
+	0x04, 0x44,
+	0x0F, 0xFC,
+	0x0F, 0xFC,
+	0x08, 0x04,
+	0x00, 0x00,
+
+	// @1804 'r'
+	0x00, 0x00,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x0F, 0xE0,
+	0x0F, 0xE0,
+	0x04, 0x20,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x0C, 0x00,
+	0x04, 0x00,
+	0x00, 0x00,
+
+	// @1826 's'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x06, 0x60,
+	0x0F, 0x60,
+	0x0B, 0x20,
+	0x0B, 0x20,
+	0x09, 0xA0,
+	0x0D, 0xE0,
+	0x0C, 0xC0,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1848 't'
+	0x00, 0x00,
+	0x08, 0x00,
+	0x08, 0x00,
+	0x7F, 0xC0,
+	0x7F, 0xE0,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x00, 0x40,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @1870 'u'
+	0x00, 0x00,
+	0x08, 0x00,
+	0x0F, 0xC0,
+	0x0F, 0xE0,
+	0x00, 0x20,
+	0x00, 0x20,
+	0x08, 0x40,
+	0x0F, 0xE0,
+	0x0F, 0xE0,
+	0x00, 0x20,
+	0x00, 0x00,
+
+	// @1892 'v'
+	0x00, 0x00,
+	0x08, 0x00,
+	0x0E, 0x00,
+	0x0F, 0x80,
+	0x09, 0xE0,
+	0x00, 0x60,
+	0x09, 0xE0,
+	0x0F, 0x80,
+	0x0E, 0x00,
+	0x08, 0x00,
+	0x00, 0x00,
+
+	// @1914 'w'
+	0x08, 0x00,
+	0x0F, 0x00,
+	0x0F, 0xE0,
+	0x08, 0xE0,
+	0x01, 0xC0,
+	0x03, 0x00,
+	0x01, 0xC0,
+	0x08, 0xE0,
+	0x0F, 0xE0,
+	0x0F, 0x00,
+	0x08, 0x00,
+
+	// @1936 'x'
+	0x00, 0x00,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x0C, 0x60,
+	0x0F, 0xE0,
+	0x03, 0x80,
+	0x0F, 0xE0,
+	0x0C, 0x60,
+	0x08, 0x20,
+	0x08, 0x20,
+	0x00, 0x00,
+
+	// @1958 'y'
+	0x00, 0x00,
+	0x08, 0x00,
+	0x0C, 0x04,
+	0x0F, 0x04,
+	0x0B, 0xCC,
+	0x00, 0x7C,
+	0x00, 0xF4,
+	0x0B, 0xC0,
+	0x0F, 0x00,
+	0x0C, 0x00,
+	0x08, 0x00,
+
+	// @1980 'z'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x0C, 0x60,
+	0x08, 0xE0,
+	0x09, 0xA0,
+	0x09, 0x20,
+	0x0B, 0x20,
+	0x0E, 0x20,
+	0x0C, 0x60,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @2002 '{'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x01, 0x00,
+	0x3F, 0xF0,
+	0x7E, 0xF8,
+	0x40, 0x08,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @2024 '|'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x7F, 0xF8,
+	0x7F, 0xF8,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @2046 '}'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x40, 0x08,
+	0x7E, 0xF8,
+	0x3F, 0xF0,
+	0x01, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+
+	// @2068 '~'
+	0x00, 0x00,
+	0x00, 0x00,
+	0x02, 0x00,
+	0x04, 0x00,
+	0x04, 0x00,
+	0x02, 0x00,
+	0x01, 0x00,
+	0x01, 0x00,
+	0x02, 0x00,
+	0x00, 0x00,
+	0x00, 0x00,
+};
+
+// 14x20: 95 glyphs x 14 columns x 3 bytes
+const uint8_t Font20_TableRot[] PROGMEM =
+{
+	// @0 ' '
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @42 '!'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x7F, 0x0C, 0x00,
+	0x7F, 0xCC, 0x00,
+	0x7F, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @84 '"'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x38, 0x00, 0x00,
+	0x3F, 0x00, 0x00,
+	0x38, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x38, 0x00, 0x00,
+	0x3F, 0x00, 0x00,
+	0x38, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @126 '#'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0xFF, 0xFF, 0x00,
+	0xFF, 0xFF, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0xFF, 0xFF, 0x00,
+	0xFF, 0xFF, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @168 '$'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x0E, 0x78, 0x00,
+	0x1F, 0x78, 0x00,
+	0x33, 0x18, 0x00,
+	0xF3, 0x1F, 0x00,
+	0xF3, 0x1F, 0x00,
+	0x31, 0x98, 0x00,
+	0x39, 0xF0, 0x00,
+	0x38, 0xE0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @210 '%'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x38, 0xC0, 0x00,
+	0x44, 0xC0, 0x00,
+	0x45, 0x80, 0x00,
+	0x45, 0x80, 0x00,
+	0x39, 0x38, 0x00,
+	0x03, 0x44, 0x00,
+	0x03, 0x44, 0x00,
+	0x06, 0x44, 0x00,
+	0x06, 0x38, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @252 '&'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x78, 0x00,
+	0x0E, 0xF8, 0x00,
+	0x0F, 0xCC, 0x00,
+	0x19, 0xCC, 0x00,
+	0x18, 0xEC, 0x00,
+	0x18, 0x7C, 0x00,
+	0x18, 0x78, 0x00,
+	0x18, 0xEC, 0x00,
+	0x00, 0xCC, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @294 '''
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x38, 0x00, 0x00,
+	0x3F, 0x00, 0x00,
+	0x38, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @336 '('
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0xF0, 0x00,
+	0x1F, 0xFE, 0x00,
+	0x7C, 0x0F, 0x80,
+	0x60, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @378 ')'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x60, 0x01, 0x80,
+	0x7C, 0x0F, 0x80,
+	0x1F, 0xFE, 0x00,
+	0x03, 0xF0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @420 '*'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x00,
+	0x0C, 0xC0, 0x00,
+	0x07, 0xC0, 0x00,
+	0x7F, 0x80, 0x00,
+	0x7F, 0x80, 0x00,
+	0x07, 0xC0, 0x00,
+	0x0C, 0xC0, 0x00,
+	0x0C, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @462 '+'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x1F, 0xF8, 0x00,
+	0x1F, 0xF8, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @504 ','
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x03, 0x80,
+	0x00, 0x1F, 0x00,
+	0x00, 0x1C, 0x00,
+	0x00, 0x10, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @546 '-'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @588 '.'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x1C, 0x00,
+	0x00, 0x1C, 0x00,
+	0x00, 0x1C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @630 '/'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x03, 0x00,
+	0x00, 0x1F, 0x00,
+	0x00, 0x7C, 0x00,
+	0x01, 0xE0, 0x00,
+	0x07, 0x80, 0x00,
+	0x3E, 0x00, 0x00,
+	0xF8, 0x00, 0x00,
+	0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @672 '0'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x0F, 0xE0, 0x00,
+	0x3F, 0xF8, 0x00,
+	0x70, 0x1C, 0x00,
+	0x60, 0x0C, 0x00,
+	0x60, 0x0C, 0x00,
+	0x60, 0x0C, 0x00,
+	0x70, 0x1C, 0x00,
+	0x3F, 0xF8, 0x00,
+	0x0F, 0xE0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @714 '1'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @756 '2'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x18, 0x0C, 0x00,
+	0x38, 0x1C, 0x00,
+	0x70, 0x3C, 0x00,
+	0x60, 0x6C, 0x00,
+	0x60, 0xCC, 0x00,
+	0x61, 0x8C, 0x00,
+	0x73, 0x0C, 0x00,
+	0x3E, 0x0C, 0x00,
+	0x1C, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @798 '3'
+	0x00, 0x00, 0x00,
+	0x00, 0x18, 0x00,
+	0x30, 0x1C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x60, 0x0C, 0x00,
+	0x63, 0x0C, 0x00,
+	0x63, 0x0C, 0x00,
+	0x63, 0x0C, 0x00,
+	0x77, 0x9C, 0x00,
+	0x3F, 0xF8, 0x00,
+	0x1C, 0xF0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @840 '4'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x00,
+	0x01, 0xE0, 0x00,
+	0x07, 0x60, 0x00,
+	0x0E, 0x60, 0x00,
+	0x38, 0x6C, 0x00,
+	0x70, 0x6C, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x00, 0x6C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @882 '5'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x18, 0x00,
+	0x7F, 0x1C, 0x00,
+	0x7F, 0x0C, 0x00,
+	0x66, 0x0C, 0x00,
+	0x66, 0x0C, 0x00,
+	0x66, 0x0C, 0x00,
+	0x67, 0x1C, 0x00,
+	0x63, 0xF8, 0x00,
+	0x01, 0xF0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @924 '6'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x07, 0xE0, 0x00,
+	0x1F, 0xF8, 0x00,
+	0x3D, 0x98, 0x00,
+	0x33, 0x0C, 0x00,
+	0x73, 0x0C, 0x00,
+	0x63, 0x0C, 0x00,
+	0x63, 0x9C, 0x00,
+	0x61, 0xF8, 0x00,
+	0x60, 0xF0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @966 '7'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x70, 0x00, 0x00,
+	0x70, 0x00, 0x00,
+	0x60, 0x00, 0x00,
+	0x60, 0x00, 0x00,
+	0x60, 0x1C, 0x00,
+	0x60, 0xFC, 0x00,
+	0x67, 0xE0, 0x00,
+	0x7F, 0x00, 0x00,
+	0x78, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1008 '8'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x1C, 0xF0, 0x00,
+	0x3F, 0xF8, 0x00,
+	0x77, 0x9C, 0x00,
+	0x63, 0x0C, 0x00,
+	0x63, 0x0C, 0x00,
+	0x63, 0x0C, 0x00,
+	0x77, 0x9C, 0x00,
+	0x3F, 0xF8, 0x00,
+	0x1C, 0xF0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1050 '9'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x1E, 0x0C, 0x00,
+	0x3F, 0x0C, 0x00,
+	0x73, 0x8C, 0x00,
+	0x61, 0x8C, 0x00,
+	0x61, 0x9C, 0x00,
+	0x61, 0x98, 0x00,
+	0x33, 0x78, 0x00,
+	0x3F, 0xF0, 0x00,
+	0x0F, 0xC0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1092 ':'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x07, 0x1C, 0x00,
+	0x07, 0x1C, 0x00,
+	0x07, 0x1C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1134 ';'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x07, 0x00,
+	0x00, 0x1E, 0x00,
+	0x07, 0x18, 0x00,
+	0x07, 0x10, 0x00,
+	0x07, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1176 '<'
+	0x00, 0x00, 0x00,
+	0x00, 0x80, 0x00,
+	0x00, 0x80, 0x00,
+	0x01, 0xC0, 0x00,
+	0x01, 0xC0, 0x00,
+	0x03, 0x60, 0x00,
+	0x06, 0x30, 0x00,
+	0x06, 0x30, 0x00,
+	0x0C, 0x18, 0x00,
+	0x0C, 0x18, 0x00,
+	0x18, 0x0C, 0x00,
+	0x18, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1218 '='
+	0x00, 0x00, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x06, 0x60, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1260 '>'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x18, 0x0C, 0x00,
+	0x18, 0x0C, 0x00,
+	0x0C, 0x18, 0x00,
+	0x0C, 0x18, 0x00,
+	0x06, 0x30, 0x00,
+	0x06, 0x30, 0x00,
+	0x03, 0x60, 0x00,
+	0x01, 0xC0, 0x00,
+	0x01, 0xC0, 0x00,
+	0x00, 0x80, 0x00,
+	0x00, 0x80, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1302 '?'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x1C, 0x00, 0x00,
+	0x3C, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0xCC, 0x00,
+	0x31, 0xCC, 0x00,
+	0x31, 0x80, 0x00,
+	0x1F, 0x00, 0x00,
+	0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1344 '@'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x0F, 0xF0, 0x00,
+	0x30, 0x0C, 0x00,
+	0x20, 0x02, 0x00,
+	0x41, 0xC2, 0x00,
+	0x42, 0x22, 0x00,
+	0x62, 0x22, 0x00,
+	0x1F, 0xE4, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1386 'A'
+	0x00, 0x00, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x1C, 0x00,
+	0x30, 0x7C, 0x00,
+	0x31, 0xEC, 0x00,
+	0x37, 0xE0, 0x00,
+	0x3E, 0x60, 0x00,
+	0x38, 0x60, 0x00,
+	0x3F, 0x60, 0x00,
+	0x07, 0xEC, 0x00,
+	0x00, 0xFC, 0x00,
+	0x00, 0x1C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1428 'B'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x31, 0x8C, 0x00,
+	0x31, 0x8C, 0x00,
+	0x31, 0x8C, 0x00,
+	0x33, 0x8C, 0x00,
+	0x1F, 0xCC, 0x00,
+	0x0E, 0xFC, 0x00,
+	0x00, 0x78, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1470 'C'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x07, 0xE0, 0x00,
+	0x0F, 0xF0, 0x00,
+	0x1C, 0x38, 0x00,
+	0x38, 0x1C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x18, 0x1C, 0x00,
+	0x3C, 0x38, 0x00,
+	0x3C, 0x30, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1512 'D'
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x38, 0x1C, 0x00,
+	0x1C, 0x38, 0x00,
+	0x0F, 0xF0, 0x00,
+	0x07, 0xE0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1554 'E'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x31, 0x8C, 0x00,
+	0x31, 0x8C, 0x00,
+	0x33, 0xCC, 0x00,
+	0x33, 0xCC, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3C, 0x3C, 0x00,
+	0x3C, 0x3C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1596 'F'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x31, 0x8C, 0x00,
+	0x31, 0x8C, 0x00,
+	0x33, 0xCC, 0x00,
+	0x33, 0xC0, 0x00,
+	0x30, 0x00, 0x00,
+	0x3C, 0x00, 0x00,
+	0x3C, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1638 'G'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x07, 0xE0, 0x00,
+	0x1F, 0xF8, 0x00,
+	0x18, 0x18, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0xCC, 0x00,
+	0x30, 0xCC, 0x00,
+	0x18, 0xCC, 0x00,
+	0x3C, 0xF8, 0x00,
+	0x3C, 0xF8, 0x00,
+	0x00, 0xC0, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1680 'H'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x31, 0x8C, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x31, 0x8C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x30, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1722 'I'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1764 'J'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0xF8, 0x00,
+	0x00, 0xF8, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x1C, 0x00,
+	0x3F, 0xF8, 0x00,
+	0x3F, 0xF0, 0x00,
+	0x30, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1806 'K'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x31, 0x8C, 0x00,
+	0x33, 0x0C, 0x00,
+	0x07, 0x80, 0x00,
+	0x3C, 0xE0, 0x00,
+	0x38, 0x78, 0x00,
+	0x38, 0x1C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1848 'L'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x7C, 0x00,
+	0x00, 0x7C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1890 'M'
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3C, 0x0C, 0x00,
+	0x07, 0x8C, 0x00,
+	0x01, 0xE0, 0x00,
+	0x01, 0xE0, 0x00,
+	0x07, 0x8C, 0x00,
+	0x3C, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x30, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1932 'N'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x1E, 0x0C, 0x00,
+	0x07, 0x8C, 0x00,
+	0x31, 0xE0, 0x00,
+	0x30, 0x78, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1974 'O'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x07, 0xE0, 0x00,
+	0x0F, 0xF0, 0x00,
+	0x1C, 0x38, 0x00,
+	0x38, 0x1C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x38, 0x1C, 0x00,
+	0x1C, 0x38, 0x00,
+	0x0F, 0xF0, 0x00,
+	0x07, 0xE0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2016 'P'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x30, 0xCC, 0x00,
+	0x30, 0xCC, 0x00,
+	0x30, 0xCC, 0x00,
+	0x30, 0xC0, 0x00,
+	0x39, 0xC0, 0x00,
+	0x1F, 0x80, 0x00,
+	0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2058 'Q'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x07, 0xE0, 0x00,
+	0x0F, 0xF0, 0x00,
+	0x1C, 0x39, 0x80,
+	0x38, 0x1F, 0x80,
+	0x30, 0x0F, 0x00,
+	0x30, 0x0F, 0x00,
+	0x38, 0x1F, 0x80,
+	0x1C, 0x39, 0x80,
+	0x0F, 0xF3, 0x80,
+	0x07, 0xE3, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2100 'R'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x31, 0x8C, 0x00,
+	0x31, 0x8C, 0x00,
+	0x31, 0x80, 0x00,
+	0x31, 0xC0, 0x00,
+	0x3B, 0xF0, 0x00,
+	0x1F, 0x78, 0x00,
+	0x0E, 0x1C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2142 'S'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x0E, 0x3C, 0x00,
+	0x1F, 0x3C, 0x00,
+	0x3B, 0x18, 0x00,
+	0x31, 0x8C, 0x00,
+	0x31, 0x8C, 0x00,
+	0x31, 0x8C, 0x00,
+	0x31, 0x8C, 0x00,
+	0x18, 0xDC, 0x00,
+	0x3C, 0xF8, 0x00,
+	0x3C, 0x70, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2184 'T'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x3E, 0x00, 0x00,
+	0x3E, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x30, 0x0C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x3E, 0x00, 0x00,
+	0x3E, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2226 'U'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x3F, 0xF0, 0x00,
+	0x3F, 0xF8, 0x00,
+	0x30, 0x1C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x30, 0x1C, 0x00,
+	0x3F, 0xF8, 0x00,
+	0x3F, 0xF0, 0x00,
+	0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2268 'V'
+	0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x3C, 0x00, 0x00,
+	0x3F, 0x00, 0x00,
+	0x33, 0xE0, 0x00,
+	0x00, 0xFC, 0x00,
+	0x00, 0x1C, 0x00,
+	0x00, 0xFC, 0x00,
+	0x33, 0xE0, 0x00,
+	0x3F, 0x00, 0x00,
+	0x3C, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2310 'W'
+	0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x3F, 0x80, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x30, 0x3C, 0x00,
+	0x30, 0xF8, 0x00,
+	0x07, 0xC0, 0x00,
+	0x07, 0x00, 0x00,
+	0x07, 0xC0, 0x00,
+	0x30, 0xF8, 0x00,
+	0x30, 0x3C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x3F, 0x80, 0x00,
+	0x30, 0x00, 0x00,
+
+	// @2352 'X'
+	0x00, 0x00, 0x00,
+	0x30, 0x0C, 0x00,
+	0x38, 0x1C, 0x00,
+	0x3C, 0x3C, 0x00,
+	0x36, 0x6C, 0x00,
+	0x03, 0xC0, 0x00,
+	0x01, 0x80, 0x00,
+	0x03, 0xC0, 0x00,
+	0x36, 0x6C, 0x00,
+	0x3C, 0x3C, 0x00,
+	0x38, 0x1C, 0x00,
+	0x30, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2394 'Y'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x38, 0x00, 0x00,
+	0x3C, 0x0C, 0x00,
+	0x37, 0x0C, 0x00,
+	0x03, 0xFC, 0x00,
+	0x03, 0xFC, 0x00,
+	0x37, 0x0C, 0x00,
+	0x3C, 0x0C, 0x00,
+	0x38, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2436 'Z'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x3C, 0x1C, 0x00,
+	0x3C, 0x3C, 0x00,
+	0x30, 0x6C, 0x00,
+	0x31, 0xCC, 0x00,
+	0x33, 0x8C, 0x00,
+	0x36, 0x0C, 0x00,
+	0x3C, 0x3C, 0x00,
+	0x38, 0x3C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2478 '['
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x7F, 0xFF, 0x80,
+	0x7F, 0xFF, 0x80,
+	0x60, 0x01, 0x80,
+	0x60, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2520 '\'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0xC0, 0x00, 0x00,
+	0xF8, 0x00, 0x00,
+	0x3E, 0x00, 0x00,
+	0x07, 0x80, 0x00,
+	0x01, 0xE0, 0x00,
+	0x00, 0x7C, 0x00,
+	0x00, 0x1F, 0x00,
+	0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2562 ']'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x60, 0x01, 0x80,
+	0x60, 0x01, 0x80,
+	0x7F, 0xFF, 0x80,
+	0x7F, 0xFF, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2604 '^'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x0C, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x60, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x0C, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2646 '_'
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+	0x00, 0x00, 0x30,
+
+	// @2688 '`'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00,
+	0x20, 0x00, 0x00,
+	0x20, 0x00, 0x00,
+	0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2730 'a'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x38, 0x00,
+	0x02, 0x7C, 0x00,
+	0x06, 0xEC, 0x00,
+	0x06, 0xCC, 0x00,
+	0x06, 0xCC, 0x00,
+	0x06, 0xCC, 0x00,
+	0x06, 0xD8, 0x00,
+	0x07, 0xFC, 0x00,
+	0x03, 0xFC, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2772 'b'
+	0x00, 0x00, 0x00,
+	0x60, 0x0C, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x03, 0x18, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x03, 0x18, 0x00,
+	0x03, 0xF8, 0x00,
+	0x00, 0xE0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2814 'c'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x00,
+	0x03, 0xF8, 0x00,
+	0x03, 0x1C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x02, 0x0C, 0x00,
+	0x07, 0x98, 0x00,
+	0x07, 0x98, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2856 'd'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x00,
+	0x03, 0xF8, 0x00,
+	0x03, 0x18, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x63, 0x18, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2898 'e'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x00,
+	0x03, 0xF8, 0x00,
+	0x03, 0xD8, 0x00,
+	0x06, 0xCC, 0x00,
+	0x06, 0xCC, 0x00,
+	0x06, 0xCC, 0x00,
+	0x06, 0xCC, 0x00,
+	0x03, 0xCC, 0x00,
+	0x03, 0xD8, 0x00,
+	0x00, 0xD8, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2940 'f'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x66, 0x0C, 0x00,
+	0x66, 0x0C, 0x00,
+	0x66, 0x0C, 0x00,
+	0x66, 0x0C, 0x00,
+	0x60, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2982 'g'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x00,
+	0x03, 0xF8, 0x00,
+	0x03, 0x18, 0xC0,
+	0x06, 0x0C, 0xC0,
+	0x06, 0x0C, 0xC0,
+	0x06, 0x0C, 0xC0,
+	0x06, 0x0C, 0xC0,
+	0x03, 0x19, 0xC0,
+	0x07, 0xFF, 0x80,
+	0x07, 0xFF, 0x00,
+	0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3024 'h'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x60, 0x0C, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x03, 0x0C, 0x00,
+	0x06, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x06, 0x0C, 0x00,
+	0x07, 0xFC, 0x00,
+	0x03, 0xFC, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3066 'i'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x67, 0xFC, 0x00,
+	0x67, 0xFC, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3108 'j'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0xC0,
+	0x06, 0x00, 0xC0,
+	0x06, 0x00, 0xC0,
+	0x06, 0x00, 0xC0,
+	0x66, 0x00, 0xC0,
+	0x66, 0x01, 0xC0,
+	0x07, 0xFF, 0x80,
+	0x07, 0xFF, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3150 'k'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x60, 0x0C, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x00, 0xC0, 0x00,
+	0x07, 0xE0, 0x00,
+	0x07, 0x3C, 0x00,
+	0x06, 0x1C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3192 'l'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x60, 0x0C, 0x00,
+	0x60, 0x0C, 0x00,
+	0x60, 0x0C, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x7F, 0xFC, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3234 'm'
+	0x00, 0x00, 0x00,
+	0x06, 0x0C, 0x00,
+	0x07, 0xFC, 0x00,
+	0x07, 0xFC, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x00, 0x00,
+	0x07, 0xFC, 0x00,
+	0x03, 0xFC, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x00, 0x00,
+	0x07, 0xFC, 0x00,
+	0x03, 0xFC, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3276 'n'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x06, 0x0C, 0x00,
+	0x07, 0xFC, 0x00,
+	0x07, 0xFC, 0x00,
+	0x03, 0x0C, 0x00,
+	0x06, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x06, 0x0C, 0x00,
+	0x07, 0xFC, 0x00,
+	0x03, 0xFC, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3318 'o'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x00,
+	0x03, 0xF8, 0x00,
+	0x03, 0x18, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x03, 0x18, 0x00,
+	0x03, 0xF8, 0x00,
+	0x00, 0xE0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3360 'p'
+	0x00, 0x00, 0x00,
+	0x06, 0x00, 0xC0,
+	0x07, 0xFF, 0xC0,
+	0x07, 0xFF, 0xC0,
+	0x03, 0x18, 0xC0,
+	0x06, 0x0C, 0xC0,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x03, 0x18, 0x00,
+	0x03, 0xF8, 0x00,
+	0x00, 0xE0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3402 'q'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0xE0, 0x00,
+	0x03, 0xF8, 0x00,
+	0x03, 0x18, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0xC0,
+	0x03, 0x18, 0xC0,
+	0x07, 0xFF, 0xC0,
+	0x07, 0xFF, 0xC0,
+	0x06, 0x00, 0xC0,
+	0x00, 0x00, 0x00,
+
+	// @3444 'r'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x07, 0xFC, 0x00,
+	0x07, 0xFC, 0x00,
+	0x01, 0x8C, 0x00,
+	0x03, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x07, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3486 's'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0x9C, 0x00,
+	0x03, 0xDC, 0x00,
+	0x06, 0xCC, 0x00,
+	0x06, 0xCC, 0x00,
+	0x06, 0x6C, 0x00,
+	0x06, 0x6C, 0x00,
+	0x07, 0x78, 0x00,
+	0x07, 0x38, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3528 't'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x3F, 0xF8, 0x00,
+	0x3F, 0xFC, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x18, 0x00,
+	0x00, 0x18, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3570 'u'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x07, 0xF8, 0x00,
+	0x07, 0xFC, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x06, 0x18, 0x00,
+	0x07, 0xFC, 0x00,
+	0x07, 0xFC, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3612 'v'
+	0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x07, 0x00, 0x00,
+	0x07, 0xC0, 0x00,
+	0x06, 0xF0, 0x00,
+	0x00, 0x3C, 0x00,
+	0x00, 0x0C, 0x00,
+	0x00, 0x3C, 0x00,
+	0x06, 0xF0, 0x00,
+	0x07, 0xC0, 0x00,
+	0x07, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3654 'w'
+	0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x07, 0xC0, 0x00,
+	0x07, 0xFC, 0x00,
+	0x06, 0x3C, 0x00,
+	0x00, 0x70, 0x00,
+	0x01, 0xC0, 0x00,
+	0x00, 0x70, 0x00,
+	0x06, 0x7C, 0x00,
+	0x07, 0xFC, 0x00,
+	0x07, 0xC0, 0x00,
+	0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3696 'x'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x07, 0x1C, 0x00,
+	0x07, 0xBC, 0x00,
+	0x00, 0xE0, 0x00,
+	0x00, 0xE0, 0x00,
+	0x07, 0xBC, 0x00,
+	0x07, 0x1C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x06, 0x0C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3738 'y'
+	0x00, 0x00, 0x00,
+	0x06, 0x00, 0xC0,
+	0x07, 0x00, 0xC0,
+	0x07, 0xC0, 0xC0,
+	0x06, 0xF1, 0xC0,
+	0x00, 0x3F, 0xC0,
+	0x00, 0x1E, 0xC0,
+	0x00, 0x38, 0xC0,
+	0x06, 0xF0, 0x00,
+	0x07, 0xC0, 0x00,
+	0x07, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3780 'z'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x07, 0x0C, 0x00,
+	0x07, 0x1C, 0x00,
+	0x06, 0x3C, 0x00,
+	0x06, 0x6C, 0x00,
+	0x06, 0xCC, 0x00,
+	0x07, 0x8C, 0x00,
+	0x07, 0x1C, 0x00,
+	0x06, 0x1C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3822 '{'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x40, 0x00,
+	0x00, 0xE0, 0x00,
+	0x3F, 0xFF, 0x00,
+	0x7F, 0xBF, 0x80,
+	0x60, 0x01, 0x80,
+	0x60, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3864 '|'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x7F, 0xFF, 0x80,
+	0x7F, 0xFF, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3906 '}'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x60, 0x01, 0x80,
+	0x60, 0x01, 0x80,
+	0x7F, 0xBF, 0x80,
+	0x3F, 0xFF, 0x00,
+	0x00, 0xE0, 0x00,
+	0x00, 0x40, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3948 '~'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0x80, 0x00,
+	0x01, 0xC0, 0x00,
+	0x00, 0xC0, 0x00,
+	0x00, 0xC0, 0x00,
+	0x01, 0xC0, 0x00,
+	0x01, 0x80, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+};
+
+// 17x24: 95 glyphs x 17 columns x 3 bytes
+const uint8_t Font24_TableRot[] PROGMEM =
+{
+	// @0 ' '
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @51 '!'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x3F, 0xE1, 0x80,
+	0x3F, 0xF9, 0x80,
+	0x3F, 0xE1, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @102 '"'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x1C, 0x00, 0x00,
+	0x1F, 0xC0, 0x00,
+	0x1C, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x1C, 0x00, 0x00,
+	0x1F, 0xC0, 0x00,
+	0x1C, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @153 '#'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0xBF, 0xC0,
+	0x3F, 0xFF, 0xC0,
+	0x3F, 0xD8, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0xBF, 0xC0,
+	0x3F, 0xFF, 0xC0,
+	0x3F, 0xD8, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @204 '$'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x07, 0x1F, 0x00,
+	0x0F, 0x9F, 0x00,
+	0x19, 0xCE, 0x00,
+	0x18, 0xC3, 0x00,
+	0x78, 0xC3, 0xF0,
+	0x78, 0xE3, 0xF0,
+	0x0E, 0x67, 0x00,
+	0x1E, 0x7E, 0x00,
+	0x1E, 0x3C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @255 '%'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x0F, 0x20, 0x00,
+	0x1F, 0xA0, 0x00,
+	0x39, 0xFE, 0x00,
+	0x30, 0xFF, 0x00,
+	0x30, 0xF3, 0x80,
+	0x39, 0xE1, 0x80,
+	0x1F, 0xE1, 0x80,
+	0x0F, 0xF3, 0x80,
+	0x00, 0xBF, 0x00,
+	0x00, 0x9E, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @306 '&'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x0E, 0x00,
+	0x03, 0x9F, 0x00,
+	0x07, 0xF9, 0x80,
+	0x0C, 0x71, 0x80,
+	0x0C, 0x39, 0x80,
+	0x0C, 0x1D, 0x80,
+	0x0E, 0x0F, 0x80,
+	0x0E, 0x0F, 0x00,
+	0x0C, 0x1F, 0x80,
+	0x00, 0x19, 0x80,
+	0x00, 0x19, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @357 '''
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x1C, 0x00, 0x00,
+	0x1F, 0xC0, 0x00,
+	0x1C, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @408 '('
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0xFC, 0x00,
+	0x07, 0xFF, 0x00,
+	0x0F, 0xFF, 0xC0,
+	0x1F, 0x03, 0xE0,
+	0x3C, 0x00, 0xF0,
+	0x30, 0x00, 0x30,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @459 ')'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x00, 0x30,
+	0x3C, 0x00, 0xF0,
+	0x1F, 0x03, 0xE0,
+	0x0F, 0xFF, 0xC0,
+	0x03, 0xFF, 0x80,
+	0x00, 0xFC, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @510 '*'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x07, 0x30, 0x00,
+	0x03, 0xF0, 0x00,
+	0x3F, 0xC0, 0x00,
+	0x3F, 0xC0, 0x00,
+	0x03, 0xF0, 0x00,
+	0x07, 0x30, 0x00,
+	0x06, 0x00, 0x00,
+	0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @561 '+'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x0F, 0xFF, 0x00,
+	0x0F, 0xFF, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @612 ','
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18,
+	0x00, 0x00, 0xF8,
+	0x00, 0x03, 0xE0,
+	0x00, 0x03, 0x80,
+	0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @663 '-'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @714 '.'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x03, 0x80,
+	0x00, 0x03, 0x80,
+	0x00, 0x03, 0x80,
+	0x00, 0x03, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @765 '/'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x70,
+	0x00, 0x01, 0xF0,
+	0x00, 0x07, 0xC0,
+	0x00, 0x1F, 0x00,
+	0x00, 0x78, 0x00,
+	0x01, 0xE0, 0x00,
+	0x0F, 0x80, 0x00,
+	0x3E, 0x00, 0x00,
+	0xF8, 0x00, 0x00,
+	0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @816 '0'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0xF8, 0x00,
+	0x0F, 0xFE, 0x00,
+	0x1C, 0x07, 0x00,
+	0x30, 0x01, 0x80,
+	0x30, 0x01, 0x80,
+	0x30, 0x01, 0x80,
+	0x30, 0x01, 0x80,
+	0x1C, 0x07, 0x00,
+	0x0F, 0xFE, 0x00,
+	0x03, 0xF8, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @867 '1'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x0C, 0x01, 0x80,
+	0x0C, 0x01, 0x80,
+	0x1C, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @918 '2'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x0E, 0x01, 0x80,
+	0x1E, 0x03, 0x80,
+	0x18, 0x07, 0x80,
+	0x30, 0x0D, 0x80,
+	0x30, 0x19, 0x80,
+	0x30, 0x31, 0x80,
+	0x30, 0x31, 0x80,
+	0x30, 0x61, 0x80,
+	0x18, 0xC1, 0x80,
+	0x1F, 0x81, 0x80,
+	0x07, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @969 '3'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x03, 0x00,
+	0x18, 0x03, 0x80,
+	0x18, 0x01, 0x80,
+	0x30, 0xC1, 0x80,
+	0x30, 0xC1, 0x80,
+	0x30, 0xC1, 0x80,
+	0x39, 0xE1, 0x80,
+	0x1F, 0x63, 0x00,
+	0x0E, 0x3F, 0x00,
+	0x00, 0x1E, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1020 '4'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x1C, 0x00,
+	0x00, 0x3C, 0x00,
+	0x00, 0xEC, 0x00,
+	0x03, 0xCC, 0x00,
+	0x07, 0x0D, 0x80,
+	0x1C, 0x0D, 0x80,
+	0x38, 0x0D, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x00, 0x0D, 0x80,
+	0x00, 0x0D, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1071 '5'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x03, 0x00,
+	0x3F, 0xC3, 0x00,
+	0x3F, 0xC1, 0x80,
+	0x30, 0xC1, 0x80,
+	0x31, 0x81, 0x80,
+	0x31, 0x81, 0x80,
+	0x31, 0x81, 0x80,
+	0x31, 0x81, 0x80,
+	0x30, 0xC3, 0x00,
+	0x30, 0xFF, 0x00,
+	0x00, 0x3C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1122 '6'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x01, 0xFC, 0x00,
+	0x07, 0xFF, 0x00,
+	0x0E, 0x63, 0x00,
+	0x1C, 0xC1, 0x80,
+	0x18, 0xC1, 0x80,
+	0x30, 0xC1, 0x80,
+	0x30, 0xC1, 0x80,
+	0x30, 0x63, 0x80,
+	0x30, 0x7F, 0x00,
+	0x30, 0x1E, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1173 '7'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x3C, 0x00, 0x00,
+	0x3C, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x30, 0x03, 0x80,
+	0x30, 0x1F, 0x80,
+	0x30, 0xFE, 0x00,
+	0x37, 0xF0, 0x00,
+	0x3F, 0x80, 0x00,
+	0x3C, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1224 '8'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x0E, 0x1E, 0x00,
+	0x1F, 0x3F, 0x00,
+	0x39, 0xE3, 0x80,
+	0x30, 0xC1, 0x80,
+	0x30, 0xC1, 0x80,
+	0x30, 0xC1, 0x80,
+	0x30, 0xC1, 0x80,
+	0x39, 0xE3, 0x80,
+	0x1F, 0x3F, 0x00,
+	0x0E, 0x1E, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1275 '9'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x0F, 0x01, 0x80,
+	0x1F, 0xC1, 0x80,
+	0x38, 0xC1, 0x80,
+	0x30, 0x61, 0x80,
+	0x30, 0x61, 0x80,
+	0x30, 0x63, 0x00,
+	0x30, 0x67, 0x00,
+	0x18, 0xCE, 0x00,
+	0x1F, 0xFC, 0x00,
+	0x07, 0xF0, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1326 ':'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0x83, 0x80,
+	0x03, 0x83, 0x80,
+	0x03, 0x83, 0x80,
+	0x03, 0x83, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1377 ';'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x60,
+	0x00, 0x03, 0xC0,
+	0x03, 0x87, 0x80,
+	0x03, 0x86, 0x00,
+	0x03, 0x84, 0x00,
+	0x03, 0x80, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1428 '<'
+	0x00, 0x20, 0x00,
+	0x00, 0x20, 0x00,
+	0x00, 0x70, 0x00,
+	0x00, 0x70, 0x00,
+	0x00, 0xD8, 0x00,
+	0x00, 0xD8, 0x00,
+	0x01, 0x8C, 0x00,
+	0x01, 0x8C, 0x00,
+	0x03, 0x06, 0x00,
+	0x03, 0x06, 0x00,
+	0x06, 0x03, 0x00,
+	0x0E, 0x03, 0x80,
+	0x0C, 0x01, 0x80,
+	0x0C, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1479 '='
+	0x00, 0x00, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1530 '>'
+	0x00, 0x00, 0x00,
+	0x0C, 0x01, 0x80,
+	0x0C, 0x01, 0x80,
+	0x0E, 0x03, 0x80,
+	0x06, 0x03, 0x00,
+	0x03, 0x06, 0x00,
+	0x03, 0x06, 0x00,
+	0x01, 0x8C, 0x00,
+	0x01, 0x8C, 0x00,
+	0x00, 0xD8, 0x00,
+	0x00, 0xD8, 0x00,
+	0x00, 0x70, 0x00,
+	0x00, 0x70, 0x00,
+	0x00, 0x20, 0x00,
+	0x00, 0x20, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1581 '?'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00,
+	0x0F, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x39, 0x80,
+	0x18, 0x39, 0x80,
+	0x18, 0x70, 0x00,
+	0x1C, 0xE0, 0x00,
+	0x0F, 0xC0, 0x00,
+	0x07, 0x80, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1632 '@'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0xFE, 0x00,
+	0x0F, 0xFF, 0x80,
+	0x1C, 0x01, 0xC0,
+	0x38, 0x00, 0xE0,
+	0x30, 0xF0, 0x60,
+	0x31, 0xF8, 0x60,
+	0x33, 0x8C, 0x60,
+	0x3B, 0x0C, 0x60,
+	0x1F, 0xFC, 0xC0,
+	0x0F, 0xFC, 0xC0,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1683 'A'
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x03, 0x80,
+	0x18, 0x0F, 0x80,
+	0x18, 0x3D, 0x80,
+	0x18, 0xF9, 0x80,
+	0x1B, 0xD8, 0x00,
+	0x1F, 0x18, 0x00,
+	0x1C, 0x18, 0x00,
+	0x0F, 0x19, 0x80,
+	0x03, 0xF9, 0x80,
+	0x00, 0xF9, 0x80,
+	0x00, 0x1F, 0x80,
+	0x00, 0x07, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+
+	// @1734 'B'
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x1C, 0xE1, 0x80,
+	0x0F, 0xF1, 0x80,
+	0x07, 0xBF, 0x00,
+	0x00, 0x1E, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1785 'C'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x01, 0xF8, 0x00,
+	0x07, 0xFE, 0x00,
+	0x0E, 0x07, 0x00,
+	0x0C, 0x03, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x0C, 0x03, 0x80,
+	0x1F, 0x07, 0x00,
+	0x1F, 0x06, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1836 'D'
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x0C, 0x03, 0x80,
+	0x0E, 0x07, 0x00,
+	0x07, 0xFE, 0x00,
+	0x01, 0xF8, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1887 'E'
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x19, 0xF9, 0x80,
+	0x19, 0xF9, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0x0F, 0x80,
+	0x1F, 0x0F, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1938 'F'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x19, 0xF9, 0x80,
+	0x19, 0xF9, 0x80,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x1F, 0x00, 0x00,
+	0x1F, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @1989 'G'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x01, 0xFC, 0x00,
+	0x07, 0xFE, 0x00,
+	0x0E, 0x07, 0x00,
+	0x0C, 0x03, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x31, 0x80,
+	0x18, 0x31, 0x80,
+	0x18, 0x31, 0x80,
+	0x0C, 0x33, 0x80,
+	0x1F, 0x3F, 0x00,
+	0x1F, 0x3F, 0x00,
+	0x00, 0x30, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2040 'H'
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2091 'I'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2142 'J'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x3F, 0x00,
+	0x00, 0x3F, 0x00,
+	0x00, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x03, 0x00,
+	0x1F, 0xFF, 0x00,
+	0x1F, 0xFC, 0x00,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2193 'K'
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x31, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0xE1, 0x80,
+	0x01, 0xF0, 0x00,
+	0x03, 0x38, 0x00,
+	0x1E, 0x1E, 0x00,
+	0x1C, 0x0F, 0x80,
+	0x18, 0x03, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+
+	// @2244 'L'
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x1F, 0x80,
+	0x00, 0x1F, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2295 'M'
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x0F, 0x01, 0x80,
+	0x03, 0xC1, 0x80,
+	0x00, 0xF1, 0x80,
+	0x00, 0x38, 0x00,
+	0x00, 0x38, 0x00,
+	0x00, 0xF1, 0x80,
+	0x03, 0xC1, 0x80,
+	0x0F, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+
+	// @2346 'N'
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x07, 0x01, 0x80,
+	0x03, 0xC1, 0x80,
+	0x01, 0xE1, 0x80,
+	0x18, 0x78, 0x00,
+	0x18, 0x3C, 0x00,
+	0x18, 0x0E, 0x00,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2397 'O'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x01, 0xF8, 0x00,
+	0x07, 0xFE, 0x00,
+	0x0F, 0x0F, 0x00,
+	0x0C, 0x03, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x0C, 0x03, 0x00,
+	0x0F, 0x0F, 0x00,
+	0x07, 0xFE, 0x00,
+	0x01, 0xF8, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2448 'P'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x31, 0x80,
+	0x18, 0x31, 0x80,
+	0x18, 0x31, 0x80,
+	0x18, 0x31, 0x80,
+	0x18, 0x30, 0x00,
+	0x1C, 0x60, 0x00,
+	0x0F, 0xE0, 0x00,
+	0x07, 0x80, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2499 'Q'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x01, 0xF8, 0x00,
+	0x07, 0xFE, 0x00,
+	0x0F, 0x0F, 0x30,
+	0x0C, 0x03, 0xF0,
+	0x18, 0x01, 0xE0,
+	0x18, 0x01, 0xE0,
+	0x18, 0x01, 0xE0,
+	0x18, 0x01, 0xE0,
+	0x0C, 0x03, 0x30,
+	0x0F, 0x0F, 0x30,
+	0x07, 0xFE, 0x70,
+	0x01, 0xF8, 0x60,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2550 'R'
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x70, 0x00,
+	0x18, 0x78, 0x00,
+	0x1C, 0xDE, 0x00,
+	0x0F, 0xCF, 0x00,
+	0x07, 0x83, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2601 'S'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x07, 0x8F, 0x80,
+	0x0F, 0xCF, 0x80,
+	0x1C, 0xC3, 0x00,
+	0x18, 0xE1, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0x71, 0x80,
+	0x0C, 0x33, 0x80,
+	0x1F, 0x3F, 0x00,
+	0x1F, 0x1E, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2652 'T'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x1F, 0x80, 0x00,
+	0x1F, 0x80, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1F, 0x80, 0x00,
+	0x1F, 0x80, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2703 'U'
+	0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x1F, 0xFC, 0x00,
+	0x1F, 0xFF, 0x00,
+	0x18, 0x03, 0x00,
+	0x18, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x03, 0x00,
+	0x1F, 0xFF, 0x00,
+	0x1F, 0xFC, 0x00,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2754 'V'
+	0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x1C, 0x00, 0x00,
+	0x1F, 0x80, 0x00,
+	0x1B, 0xE0, 0x00,
+	0x18, 0x7C, 0x00,
+	0x18, 0x1F, 0x00,
+	0x00, 0x03, 0x80,
+	0x18, 0x1F, 0x00,
+	0x18, 0x7C, 0x00,
+	0x1B, 0xE0, 0x00,
+	0x1F, 0x80, 0x00,
+	0x1C, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2805 'W'
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x1F, 0x00, 0x00,
+	0x1F, 0xF8, 0x00,
+	0x18, 0xFF, 0x80,
+	0x18, 0x0F, 0x80,
+	0x18, 0x3E, 0x00,
+	0x00, 0xF0, 0x00,
+	0x01, 0xC0, 0x00,
+	0x00, 0xF8, 0x00,
+	0x18, 0x3E, 0x00,
+	0x18, 0x0F, 0x80,
+	0x18, 0xFF, 0x80,
+	0x1F, 0xF8, 0x00,
+	0x1F, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+
+	// @2856 'X'
+	0x00, 0x00, 0x00,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x1C, 0x03, 0x80,
+	0x1E, 0x07, 0x80,
+	0x1B, 0x0D, 0x80,
+	0x19, 0x99, 0x80,
+	0x00, 0xF0, 0x00,
+	0x00, 0xF0, 0x00,
+	0x19, 0x99, 0x80,
+	0x1B, 0x0D, 0x80,
+	0x1E, 0x07, 0x80,
+	0x1C, 0x03, 0x80,
+	0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2907 'Y'
+	0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x1C, 0x00, 0x00,
+	0x1E, 0x01, 0x80,
+	0x1B, 0x81, 0x80,
+	0x01, 0xC1, 0x80,
+	0x00, 0x7F, 0x80,
+	0x00, 0x7F, 0x80,
+	0x19, 0xC1, 0x80,
+	0x1B, 0x81, 0x80,
+	0x1E, 0x01, 0x80,
+	0x1C, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @2958 'Z'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x03, 0x80,
+	0x1F, 0x87, 0x80,
+	0x1F, 0x8D, 0x80,
+	0x18, 0x19, 0x80,
+	0x18, 0x31, 0x80,
+	0x18, 0x61, 0x80,
+	0x18, 0xC1, 0x80,
+	0x19, 0x81, 0x80,
+	0x1B, 0x01, 0x80,
+	0x1E, 0x1F, 0x80,
+	0x1C, 0x1F, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3009 '['
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x3F, 0xFF, 0xF0,
+	0x3F, 0xFF, 0xF0,
+	0x30, 0x00, 0x30,
+	0x30, 0x00, 0x30,
+	0x30, 0x00, 0x30,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3060 '\'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0xE0, 0x00, 0x00,
+	0xF8, 0x00, 0x00,
+	0x3E, 0x00, 0x00,
+	0x0F, 0x80, 0x00,
+	0x01, 0xE0, 0x00,
+	0x00, 0x78, 0x00,
+	0x00, 0x1F, 0x00,
+	0x00, 0x07, 0xC0,
+	0x00, 0x01, 0xF0,
+	0x00, 0x00, 0x70,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3111 ']'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x00, 0x30,
+	0x30, 0x00, 0x30,
+	0x30, 0x00, 0x30,
+	0x3F, 0xFF, 0xF0,
+	0x3F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3162 '^'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x01, 0x80, 0x00,
+	0x03, 0x00, 0x00,
+	0x0E, 0x00, 0x00,
+	0x1C, 0x00, 0x00,
+	0x38, 0x00, 0x00,
+	0x70, 0x00, 0x00,
+	0x38, 0x00, 0x00,
+	0x1C, 0x00, 0x00,
+	0x0E, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x01, 0x80, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3213 '_'
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00,
+
+	// @3264 '`'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x60, 0x00, 0x00,
+	0x60, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3315 'a'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x0E, 0x00,
+	0x01, 0x1F, 0x00,
+	0x03, 0x19, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x33, 0x00,
+	0x01, 0xFF, 0x80,
+	0x00, 0xFF, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3366 'b'
+	0x00, 0x00, 0x00,
+	0x30, 0x01, 0x80,
+	0x30, 0x01, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x01, 0x83, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x01, 0x83, 0x00,
+	0x01, 0xFF, 0x00,
+	0x00, 0x7C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3417 'c'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x7C, 0x00,
+	0x00, 0xFE, 0x00,
+	0x01, 0xC7, 0x00,
+	0x01, 0x83, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x01, 0x83, 0x80,
+	0x03, 0xE7, 0x00,
+	0x03, 0xE6, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3468 'd'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x7C, 0x00,
+	0x01, 0xFF, 0x00,
+	0x01, 0x83, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x33, 0x01, 0x80,
+	0x31, 0x83, 0x00,
+	0x3F, 0xFF, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3519 'e'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x7C, 0x00,
+	0x01, 0xFF, 0x00,
+	0x01, 0xB3, 0x00,
+	0x03, 0x31, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x31, 0x80,
+	0x01, 0xB1, 0x80,
+	0x01, 0xF3, 0x00,
+	0x00, 0x73, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3570 'f'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x0F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80,
+	0x33, 0x01, 0x80,
+	0x33, 0x01, 0x80,
+	0x33, 0x01, 0x80,
+	0x33, 0x01, 0x80,
+	0x33, 0x01, 0x80,
+	0x33, 0x00, 0x00,
+	0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3621 'g'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x7C, 0x00,
+	0x01, 0xFF, 0x00,
+	0x01, 0x83, 0x0C,
+	0x03, 0x01, 0x8C,
+	0x03, 0x01, 0x8C,
+	0x03, 0x01, 0x8C,
+	0x03, 0x01, 0x8C,
+	0x03, 0x01, 0x8C,
+	0x01, 0x83, 0x18,
+	0x03, 0xFF, 0xF8,
+	0x03, 0xFF, 0xF0,
+	0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3672 'h'
+	0x00, 0x00, 0x00,
+	0x30, 0x01, 0x80,
+	0x30, 0x01, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x01, 0x81, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x81, 0x80,
+	0x01, 0xFF, 0x80,
+	0x00, 0xFF, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3723 'i'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x33, 0xFF, 0x80,
+	0x33, 0xFF, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3774 'j'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0x00, 0x0C,
+	0x03, 0x00, 0x0C,
+	0x03, 0x00, 0x0C,
+	0x03, 0x00, 0x0C,
+	0x03, 0x00, 0x0C,
+	0x33, 0x00, 0x0C,
+	0x33, 0x00, 0x18,
+	0x03, 0xFF, 0xF8,
+	0x03, 0xFF, 0xF0,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3825 'k'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x01, 0x80,
+	0x30, 0x01, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x00, 0x38, 0x00,
+	0x00, 0x7C, 0x00,
+	0x03, 0xEE, 0x00,
+	0x03, 0x87, 0x80,
+	0x03, 0x03, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3876 'l'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x01, 0x80,
+	0x30, 0x01, 0x80,
+	0x30, 0x01, 0x80,
+	0x30, 0x01, 0x80,
+	0x30, 0x01, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x3F, 0xFF, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @3927 'm'
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0xFF, 0x80,
+	0x03, 0xFF, 0x80,
+	0x01, 0x81, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x00, 0x00,
+	0x03, 0xFF, 0x80,
+	0x01, 0xFF, 0x80,
+	0x03, 0x81, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x00, 0x00,
+	0x03, 0xFF, 0x80,
+	0x01, 0xFF, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+
+	// @3978 'n'
+	0x00, 0x00, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0xFF, 0x80,
+	0x03, 0xFF, 0x80,
+	0x01, 0x81, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x81, 0x80,
+	0x01, 0xFF, 0x80,
+	0x00, 0xFF, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4029 'o'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x7C, 0x00,
+	0x00, 0xFE, 0x00,
+	0x01, 0xC7, 0x00,
+	0x01, 0x83, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x01, 0x83, 0x00,
+	0x01, 0xC7, 0x00,
+	0x00, 0xFE, 0x00,
+	0x00, 0x7C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4080 'p'
+	0x00, 0x00, 0x00,
+	0x03, 0x00, 0x0C,
+	0x03, 0x00, 0x0C,
+	0x03, 0xFF, 0xFC,
+	0x03, 0xFF, 0xFC,
+	0x01, 0x83, 0x0C,
+	0x03, 0x01, 0x8C,
+	0x03, 0x01, 0x8C,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x01, 0x83, 0x00,
+	0x01, 0xFF, 0x00,
+	0x00, 0x7C, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4131 'q'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x7C, 0x00,
+	0x01, 0xFF, 0x00,
+	0x01, 0x83, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x8C,
+	0x03, 0x01, 0x8C,
+	0x01, 0x83, 0x0C,
+	0x03, 0xFF, 0xFC,
+	0x03, 0xFF, 0xFC,
+	0x03, 0x00, 0x0C,
+	0x03, 0x00, 0x0C,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4182 'r'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0xFF, 0x80,
+	0x03, 0xFF, 0x80,
+	0x00, 0xC1, 0x80,
+	0x01, 0x81, 0x80,
+	0x03, 0x81, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x80, 0x00,
+	0x01, 0x80, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4233 's'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0xE7, 0x80,
+	0x01, 0xF7, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x39, 0x80,
+	0x03, 0x19, 0x80,
+	0x03, 0x1B, 0x80,
+	0x03, 0xDF, 0x00,
+	0x03, 0xCE, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4284 't'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x3F, 0xFE, 0x00,
+	0x3F, 0xFF, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x03, 0x80,
+	0x00, 0x03, 0x00,
+	0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4335 'u'
+	0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0xFE, 0x00,
+	0x03, 0xFF, 0x00,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x03, 0x00,
+	0x03, 0xFF, 0x80,
+	0x03, 0xFF, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4386 'v'
+	0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0xC0, 0x00,
+	0x03, 0xF0, 0x00,
+	0x03, 0x3E, 0x00,
+	0x00, 0x0F, 0x80,
+	0x00, 0x03, 0x80,
+	0x00, 0x03, 0x80,
+	0x00, 0x0F, 0x80,
+	0x03, 0x3E, 0x00,
+	0x03, 0xF0, 0x00,
+	0x03, 0xC0, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4437 'w'
+	0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0xE0, 0x00,
+	0x03, 0xFE, 0x00,
+	0x03, 0x1F, 0x80,
+	0x00, 0x0F, 0x80,
+	0x00, 0x7C, 0x00,
+	0x00, 0xE0, 0x00,
+	0x00, 0x7C, 0x00,
+	0x00, 0x0F, 0x80,
+	0x03, 0x1F, 0x80,
+	0x03, 0xFC, 0x00,
+	0x03, 0xE0, 0x00,
+	0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4488 'x'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x83, 0x80,
+	0x03, 0xC7, 0x80,
+	0x03, 0x6D, 0x80,
+	0x00, 0x38, 0x00,
+	0x00, 0x38, 0x00,
+	0x03, 0x6D, 0x80,
+	0x03, 0xC7, 0x80,
+	0x03, 0x83, 0x80,
+	0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4539 'y'
+	0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0x00, 0x0C,
+	0x03, 0x80, 0x0C,
+	0x03, 0xE0, 0x0C,
+	0x03, 0x78, 0x0C,
+	0x03, 0x1E, 0x1C,
+	0x00, 0x07, 0x7C,
+	0x00, 0x03, 0xEC,
+	0x00, 0x07, 0x8C,
+	0x00, 0x1E, 0x00,
+	0x03, 0x78, 0x00,
+	0x03, 0xE0, 0x00,
+	0x03, 0x80, 0x00,
+	0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4590 'z'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x03, 0xC1, 0x80,
+	0x03, 0xC3, 0x80,
+	0x03, 0x07, 0x80,
+	0x03, 0x0D, 0x80,
+	0x03, 0x19, 0x80,
+	0x03, 0x31, 0x80,
+	0x03, 0x61, 0x80,
+	0x03, 0xC1, 0x80,
+	0x03, 0x87, 0x80,
+	0x03, 0x07, 0x80,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4641 '{'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00,
+	0x00, 0x38, 0x00,
+	0x1F, 0xFF, 0xE0,
+	0x3F, 0xEF, 0xF0,
+	0x30, 0x00, 0x30,
+	0x30, 0x00, 0x30,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4692 '|'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x3F, 0xFF, 0xF0,
+	0x3F, 0xFF, 0xF0,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4743 '}'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x30, 0x00, 0x30,
+	0x30, 0x00, 0x30,
+	0x3F, 0xEF, 0xF0,
+	0x1F, 0xFF, 0xE0,
+	0x00, 0x38, 0x00,
+	0x00, 0x10, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+
+	// @4794 '~'
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00,
+	0x00, 0x70, 0x00,
+	0x00, 0xE0, 0x00,
+	0x00, 0xC0, 0x00,
+	0x00, 0xE0, 0x00,
+	0x00, 0x70, 0x00,
+	0x00, 0x38, 0x00,
+	0x00, 0x18, 0x00,
+	0x00, 0x38, 0x00,
+	0x00, 0x70, 0x00,
+	0x00, 0x60, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00,
+};
@@ -7,12 +7,13 @@
  *         annoyed, dizzy, sad, angry, confused, focused,
  *         tired, asleep
  *
- *  Animation: 8-phase eye cycle (mood-aware).
+ *  Animation: one looping keyframe clip per mood (timeline.h).
  *  Shake system: gentle → amused → annoyed → dizzy.
  *  Idle decay: after long inactivity → bored.
  * ============================================================
  */
 #include <Arduino.h>
+#include "timeline.h"
 
 // ── Moods ───────────────────────────────────────────────────
 enum PetMood {
@@ -33,32 +34,80 @@ enum PetMood {
 };
 
 // ── Animation ───────────────────────────────────────────────
-//  0 normal → 1 look-L → 2 normal → 3 blink
-//  4 normal → 5 look-R → 6 normal → 7 mood-special
-static const uint8_t  PET_ANIM_PHASES = 8;
-static const uint16_t PET_ANIM_MS[8]  = {
-  2000, 800, 1500, 300, 2000, 800, 1500, 1200
+// Each mood loops a clip of poses. Moods whose eyes ignore the pupil
+// offset only blink; only happy/cute have a distinct special frame.
+enum PetPose : uint8_t {
+  POSE_OPEN,
+  POSE_LOOK_L,
+  POSE_LOOK_R,
+  POSE_BLINK,
+  POSE_SPECIAL,        // mood-specific frame
+  POSE_ZZZ_0,          // asleep: floating zzz, three positions
+  POSE_ZZZ_1,
+  POSE_ZZZ_2,
 };
 
+// normal → look-L → normal → blink → normal → look-R → normal → special
+static const Keyframe CLIP_LIVELY[] PROGMEM = {
+  {2000, POSE_OPEN}, { 800, POSE_LOOK_L}, {1500, POSE_OPEN}, { 300, POSE_BLINK},
+  {2000, POSE_OPEN}, { 800, POSE_LOOK_R}, {1500, POSE_OPEN}, {1200, POSE_SPECIAL},
+};
+// the same without the special frame
+static const Keyframe CLIP_CURIOUS[] PROGMEM = {
+  {2000, POSE_OPEN}, { 800, POSE_LOOK_L}, {1500, POSE_OPEN}, { 300, POSE_BLINK},
+  {2000, POSE_OPEN}, { 800, POSE_LOOK_R}, {2700, POSE_OPEN},
+};
+// blink once per cycle, same cycle length
+static const Keyframe CLIP_CALM[] PROGMEM = {
+  {4300, POSE_OPEN}, { 300, POSE_BLINK}, {5500, POSE_OPEN},
+};
+static const Keyframe CLIP_ASLEEP[] PROGMEM = {
+  {2000, POSE_ZZZ_0}, {2000, POSE_ZZZ_1}, {2000, POSE_ZZZ_2},
+};
+
+#define CLIP(c) c, sizeof(c) / sizeof(c[0])
+
 static PetMood  _mood          = MOOD_HAPPY;
-static uint8_t  _animPhase     = 0;
+static Timeline _anim         = { CLIP(CLIP_LIVELY), 0, 2000 };   // happy from boot
+static uint8_t  _pose          = POSE_OPEN;
 static uint32_t _lastAnimTick  = 0;
 
+/* advance the mood clip; true when the pose on screen changed. Only
+ * keyframes are reported: a setPetMood() is not, so its caller must
+ * redraw itself (the new clip starts on a pose already shown) */
 bool tickPetAnimation() {
-  if (millis() - _lastAnimTick < PET_ANIM_MS[_animPhase]) return false;
-  _lastAnimTick = millis();
-  _animPhase = (_animPhase + 1) % PET_ANIM_PHASES;
+  uint32_t now = millis();
+  if (!timelineAdvance(_anim, now)) return false;
+  _lastAnimTick = now;
+  uint8_t pose = timelinePose(_anim);
+  if (pose == _pose) return false;
+  _pose = pose;
   return true;
 }
 
+/* ms until the next keyframe of the mood clip */
+uint32_t petMsToNextFrame() { return timelineMsLeft(_anim, millis()); }
+
+/* millis() of the next keyframe */
+uint32_t petNextFrameAt() { return _anim.due; }
+
+/* switch mood and restart its clip at the first pose; the caller
+ * requests the redraw, tickPetAnimation() will not report it */
 void setPetMood(PetMood m) {
   _mood = m;
-  _animPhase = 0;
   _lastAnimTick = millis();
+  switch (m) {
+    case MOOD_HAPPY:
+    case MOOD_CUTE:       timelinePlay(_anim, CLIP(CLIP_LIVELY),  _lastAnimTick); break;
+    case MOOD_INTERESTED: timelinePlay(_anim, CLIP(CLIP_CURIOUS), _lastAnimTick); break;
+    case MOOD_ASLEEP:     timelinePlay(_anim, CLIP(CLIP_ASLEEP),  _lastAnimTick); break;
+    default:              timelinePlay(_anim, CLIP(CLIP_CALM),    _lastAnimTick); break;
+  }
+  _pose = timelinePose(_anim);
 }
 
 PetMood     getPetMood()      { return _mood; }
-uint8_t     getPetAnimPhase() { return _animPhase; }
+uint8_t     getPetPose()      { return _pose; }
 
 const char* getPetMoodName() {
   switch (_mood) {
@@ -82,19 +131,24 @@ const char* getPetMoodName() {
 
 /* pupil horizontal offset */
 int8_t getPetEyeOffsetX() {
-  if (_animPhase == 1) return -8;
-  if (_animPhase == 5) return  8;
+  if (_pose == POSE_LOOK_L) return -8;
+  if (_pose == POSE_LOOK_R) return  8;
   return 0;
 }
 
 /* 0=open, 2=closed */
 uint8_t getPetBlinkLevel() {
-  return (_animPhase == 3) ? 2 : 0;
+  return (_pose == POSE_BLINK) ? 2 : 0;
 }
 
-/* phase 7 = mood-specific special frame */
+/* mood-specific special frame */
 bool isPetSpecialPhase() {
-  return (_animPhase == 7);
+  return (_pose == POSE_SPECIAL);
+}
+
+/* asleep: position of the floating zzz, 0..2 */
+uint8_t getPetZzzFrame() {
+  return _pose >= POSE_ZZZ_0 ? _pose - POSE_ZZZ_0 : 0;
 }
 
 // ── Shake reaction system ───────────────────────────────────
@@ -20,6 +20,13 @@ static bool     _breakFinished = false;
 
 static uint8_t  _completedCycles = 0;
 
+static const uint32_t TIMER_NO_CHANGE = 0xFFFFFFFFUL;
+
+/* ms until (remaining / 1000) next drops, remaining = ms left */
+static uint32_t msToNextSecond(uint32_t remaining) {
+  return remaining ? remaining % 1000 + 1 : TIMER_NO_CHANGE;
+}
+
 // ── Focus timer ─────────────────────────────────────────────
 void initPomodoro() {
   _pomRunning  = false;
@@ -72,11 +79,22 @@ bool isPomodoroFinished() {
   return false;
 }
 
-uint32_t pomodoroSecondsLeft() {
+/* ms of focus left, as of aheadMs from now */
+static uint32_t pomodoroMsLeft(uint32_t aheadMs) {
   uint32_t total = _pomElapsed;
-  if (_pomRunning) total += millis() - _pomStart;
-  if (total >= _pomDuration) return 0;
-  return (_pomDuration - total) / 1000;
+  if (_pomRunning) total += millis() - _pomStart + aheadMs;
+  return total >= _pomDuration ? 0 : _pomDuration - total;
+}
+
+uint32_t pomodoroSecondsLeft(uint32_t aheadMs = 0) {
+  return pomodoroMsLeft(aheadMs) / 1000;
+}
+
+/* ms until pomodoroSecondsLeft(aheadMs) changes; TIMER_NO_CHANGE
+ * while paused or once it reads 0 */
+uint32_t pomodoroMsToNextSecond(uint32_t aheadMs = 0) {
+  if (!_pomRunning) return TIMER_NO_CHANGE;
+  return msToNextSecond(pomodoroMsLeft(aheadMs));
 }
 
 // ── Break timer ─────────────────────────────────────────────
@@ -96,11 +114,26 @@ bool isBreakFinished() {
   return false;
 }
 
-uint32_t breakSecondsLeft() {
-  uint32_t e = millis() - _breakStart;
-  if (e >= _breakDuration) return 0;
-  return (_breakDuration - e) / 1000;
+static uint32_t breakMsLeft(uint32_t aheadMs) {
+  uint32_t e = millis() - _breakStart + aheadMs;
+  return e >= _breakDuration ? 0 : _breakDuration - e;
+}
+
+uint32_t breakSecondsLeft(uint32_t aheadMs = 0) {
+  return breakMsLeft(aheadMs) / 1000;
+}
+
+uint32_t breakMsToNextSecond(uint32_t aheadMs = 0) {
+  return msToNextSecond(breakMsLeft(aheadMs));
 }
 
 // ── Getters ─────────────────────────────────────────────────
 uint8_t getCompletedCycleCount() { return _completedCycles; }
+
+/* the countdown on `mode`'s screen (focus or break) */
+uint32_t timerSecondsLeft(int mode, uint32_t aheadMs) {
+  return mode == MODE_BREAK ? breakSecondsLeft(aheadMs) : pomodoroSecondsLeft(aheadMs);
+}
+uint32_t timerMsToNextSecond(int mode, uint32_t aheadMs) {
+  return mode == MODE_BREAK ? breakMsToNextSecond(aheadMs) : pomodoroMsToNextSecond(aheadMs);
+}
@@ -0,0 +1,105 @@
+#pragma once
+/*
+ * ============================================================
+ *  scheduler.h — Cooperative run-to-completion task scheduler
+ *
+ *  Tasks live in a table ordered by priority, most urgent
+ *  first. A task is released by its period, or by taskWake() /
+ *  taskRunIn() / taskRunAt() for on-demand and deadline-driven
+ *  work. schedulerRunOne() runs the most urgent released task
+ *  and times it: a start later than deadlineMs after release
+ *  is a miss, a run longer than budgetUs is an overrun.
+ * ============================================================
+ */
+#include <Arduino.h>
+
+typedef void (*TaskFn)();
+
+struct Task {
+  const char* name;
+  TaskFn   fn;
+  uint16_t periodMs;           // 0 = only runs when released
+  uint16_t deadlineMs;         // release -> start
+  uint32_t budgetUs;           // start -> end
+
+  bool     armed     = false;
+  uint32_t releaseAt = 0;      // millis()
+
+  uint32_t runs      = 0;
+  uint64_t totalUs   = 0;      // 32 bits would wrap after ~71 min
+  uint32_t maxUs     = 0;
+  uint32_t missed    = 0;      // started after the deadline
+  uint32_t overruns  = 0;      // ran over budget
+};
+
+static Task*   _tasks     = NULL;
+static uint8_t _taskCount = 0;
+
+/* tasks with a period are released right away, the others on demand */
+void schedulerBegin(Task* tasks, uint8_t count) {
+  _tasks     = tasks;
+  _taskCount = count;
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < count; i++) {
+    tasks[i].armed     = tasks[i].periodMs != 0;
+    tasks[i].releaseAt = now;
+  }
+}
+
+/* release task `id` at `at` (millis()), replacing any pending release */
+void taskRunAt(uint8_t id, uint32_t at) {
+  _tasks[id].armed     = true;
+  _tasks[id].releaseAt = at;
+}
+
+void taskRunIn(uint8_t id, uint32_t ms) { taskRunAt(id, millis() + ms); }
+
+/* release task `id` now; an earlier pending release is kept */
+void taskWake(uint8_t id) {
+  Task& t = _tasks[id];
+  uint32_t now = millis();
+  if (!t.armed || (int32_t)(t.releaseAt - now) > 0) taskRunAt(id, now);
+}
+
+/* run the most urgent released task; false if none was due. A task
+ * that does not re-release itself goes back to its period */
+bool schedulerRunOne() {
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < _taskCount; i++) {
+    Task& t = _tasks[i];
+    if (!t.armed || (int32_t)(now - t.releaseAt) < 0) continue;
+
+    uint32_t release = t.releaseAt;
+    if (now - release > t.deadlineMs) t.missed++;
+    t.armed = false;
+    uint32_t start = micros();
+    t.fn();
+    uint32_t us = micros() - start;
+
+    t.runs++;
+    t.totalUs += us;
+    if (us > t.maxUs) t.maxUs = us;
+    if (us > t.budgetUs) t.overruns++;
+
+    if (!t.armed && t.periodMs) {      // next period, skipping any missed
+      uint32_t behind = millis() - release;
+      t.armed     = true;
+      t.releaseAt = release + (behind / t.periodMs + 1) * t.periodMs;
+    }
+    return true;
+  }
+  return false;
+}
+
+/* one line per task: runs, mean and worst runtime, misses, overruns */
+void printTaskStats() {
+  for (uint8_t i = 0; i < _taskCount; i++) {
+    const Task& t = _tasks[i];
+    Serial.print(F("[Task] "));  Serial.print(t.name);
+    Serial.print(F(" runs "));   Serial.print(t.runs);
+    Serial.print(F(" avg "));    Serial.print((uint32_t)(t.runs ? t.totalUs / t.runs : 0));
+    Serial.print(F(" us max ")); Serial.print(t.maxUs);
+    Serial.print(F(" us missed ")); Serial.print(t.missed);
+    Serial.print(F(" over "));   Serial.println(t.overruns);
+  }
+}
@@ -0,0 +1,227 @@
+#pragma once
+/*
+ * ============================================================
+ *  sprites.h — Pre-baked 1 bpp decorations for the pet screens
+ *
+ *  Mood symbols and night-sky pieces used to be drawn from
+ *  circles and lines on every frame; they are stored here as
+ *  PROGMEM bitmaps (rows of (w + 7) / 8 bytes, MSB = leftmost
+ *  pixel, 1 = ink) and blitted with Paint::DrawBitmap.
+ *  sprites_rot.h holds the column-major copies the landscape
+ *  rotations blit from (regenerate with tools/spriterot).
+ *  (cx, cy) is the anchor the old drawing code centred on.
+ * ============================================================
+ */
+#include <Arduino.h>
+
+struct Sprite {
+  uint8_t w, h;                // size in pixels
+  uint8_t cx, cy;              // anchor within the bitmap
+  const unsigned char* bits;
+  const unsigned char* bits_rot;   // column-major copy for ROTATE_90/270
+};
+
+#ifndef SPRITES_ROT_STUBS
+#include "sprites_rot.h"
+#endif
+
+// ── Sparkle ✦ (drawSparkle, s = 2..5) ───────────────────────
+// sparkle, s = 2, 5x5
+static const unsigned char SPR_SPARKLE_2_BITS[] PROGMEM = {
+  0x20,             // ..#..
+  0x20,             // ..#..
+  0xF8,             // #####
+  0x20,             // ..#..
+  0x20,             // ..#..
+};
+static const Sprite SPR_SPARKLE_2 = { 5, 5, 2, 2, SPR_SPARKLE_2_BITS, SPR_SPARKLE_2_ROT };
+
+// sparkle, s = 3, 7x7
+static const unsigned char SPR_SPARKLE_3_BITS[] PROGMEM = {
+  0x10,             // ...#...
+  0x10,             // ...#...
+  0x10,             // ...#...
+  0xFE,             // #######
+  0x10,             // ...#...
+  0x10,             // ...#...
+  0x10,             // ...#...
+};
+static const Sprite SPR_SPARKLE_3 = { 7, 7, 3, 3, SPR_SPARKLE_3_BITS, SPR_SPARKLE_3_ROT };
+
+// sparkle, s = 4, 9x9
+static const unsigned char SPR_SPARKLE_4_BITS[] PROGMEM = {
+  0x08, 0x00,       // ....#....
+  0x08, 0x00,       // ....#....
+  0x08, 0x00,       // ....#....
+  0x08, 0x00,       // ....#....
+  0xFF, 0x80,       // #########
+  0x08, 0x00,       // ....#....
+  0x08, 0x00,       // ....#....
+  0x08, 0x00,       // ....#....
+  0x08, 0x00,       // ....#....
+};
+static const Sprite SPR_SPARKLE_4 = { 9, 9, 4, 4, SPR_SPARKLE_4_BITS, SPR_SPARKLE_4_ROT };
+
+// sparkle, s = 5, 11x11
+static const unsigned char SPR_SPARKLE_5_BITS[] PROGMEM = {
+  0x04, 0x00,       // .....#.....
+  0x04, 0x00,       // .....#.....
+  0x04, 0x00,       // .....#.....
+  0x04, 0x00,       // .....#.....
+  0x04, 0x00,       // .....#.....
+  0xFF, 0xE0,       // ###########
+  0x04, 0x00,       // .....#.....
+  0x04, 0x00,       // .....#.....
+  0x04, 0x00,       // .....#.....
+  0x04, 0x00,       // .....#.....
+  0x04, 0x00,       // .....#.....
+};
+static const Sprite SPR_SPARKLE_5 = { 11, 11, 5, 5, SPR_SPARKLE_5_BITS, SPR_SPARKLE_5_ROT };
+
+// ── Anger mark ╳ (drawAngerMark, s = 4..6) ──────────────────
+
+// anger mark, s = 4, 11x11
+static const unsigned char SPR_ANGER_4_BITS[] PROGMEM = {
+  0xE0, 0xE0,       // ###.....###
+  0xF1, 0xE0,       // ####...####
+  0xFB, 0xE0,       // #####.#####
+  0x7F, 0xC0,       // .#########.
+  0x3F, 0x80,       // ..#######..
+  0x1F, 0x00,       // ...#####...
+  0x3F, 0x80,       // ..#######..
+  0x7F, 0xC0,       // .#########.
+  0xFB, 0xE0,       // #####.#####
+  0xF1, 0xE0,       // ####...####
+  0xE0, 0xE0,       // ###.....###
+};
+static const Sprite SPR_ANGER_4 = { 11, 11, 5, 5, SPR_ANGER_4_BITS, SPR_ANGER_4_ROT };
+
+// anger mark, s = 5, 13x13
+static const unsigned char SPR_ANGER_5_BITS[] PROGMEM = {
+  0xE0, 0x38,       // ###.......###
+  0xF0, 0x78,       // ####.....####
+  0xF8, 0xF8,       // #####...#####
+  0x7D, 0xF0,       // .#####.#####.
+  0x3F, 0xE0,       // ..#########..
+  0x1F, 0xC0,       // ...#######...
+  0x0F, 0x80,       // ....#####....
+  0x1F, 0xC0,       // ...#######...
+  0x3F, 0xE0,       // ..#########..
+  0x7D, 0xF0,       // .#####.#####.
+  0xF8, 0xF8,       // #####...#####
+  0xF0, 0x78,       // ####.....####
+  0xE0, 0x38,       // ###.......###
+};
+static const Sprite SPR_ANGER_5 = { 13, 13, 6, 6, SPR_ANGER_5_BITS, SPR_ANGER_5_ROT };
+
+// anger mark, s = 6, 15x15
+static const unsigned char SPR_ANGER_6_BITS[] PROGMEM = {
+  0xE0, 0x0E,       // ###.........###
+  0xF0, 0x1E,       // ####.......####
+  0xF8, 0x3E,       // #####.....#####
+  0x7C, 0x7C,       // .#####...#####.
+  0x3E, 0xF8,       // ..#####.#####..
+  0x1F, 0xF0,       // ...#########...
+  0x0F, 0xE0,       // ....#######....
+  0x07, 0xC0,       // .....#####.....
+  0x0F, 0xE0,       // ....#######....
+  0x1F, 0xF0,       // ...#########...
+  0x3E, 0xF8,       // ..#####.#####..
+  0x7C, 0x7C,       // .#####...#####.
+  0xF8, 0x3E,       // #####.....#####
+  0xF0, 0x1E,       // ####.......####
+  0xE0, 0x0E,       // ###.........###
+};
+static const Sprite SPR_ANGER_6 = { 15, 15, 7, 7, SPR_ANGER_6_BITS, SPR_ANGER_6_ROT };
+
+// ── Heart (drawHeart, s = 3..5) ─────────────────────────────
+
+// heart, s = 3, 13x10
+static const unsigned char SPR_HEART_3_BITS[] PROGMEM = {
+  0x38, 0xE0,       // ..###...###..
+  0x7D, 0xF0,       // .#####.#####.
+  0xFF, 0xF8,       // #############
+  0xFF, 0xF8,       // #############
+  0xFF, 0xF8,       // #############
+  0x7F, 0xF0,       // .###########.
+  0x3F, 0xE0,       // ..#########..
+  0x0F, 0x80,       // ....#####....
+  0x07, 0x00,       // .....###.....
+  0x02, 0x00,       // ......#......
+};
+static const Sprite SPR_HEART_3 = { 13, 10, 6, 3, SPR_HEART_3_BITS, SPR_HEART_3_ROT };
+
+// heart, s = 4, 17x13
+static const unsigned char SPR_HEART_4_BITS[] PROGMEM = {
+  0x1C, 0x1C, 0x00, // ...###.....###...
+  0x3E, 0x3E, 0x00, // ..#####...#####..
+  0x7F, 0x7F, 0x00, // .#######.#######.
+  0xFF, 0xFF, 0x80, // #################
+  0xFF, 0xFF, 0x80, // #################
+  0xFF, 0xFF, 0x80, // #################
+  0x7F, 0xFF, 0x00, // .###############.
+  0x3F, 0xFE, 0x00, // ..#############..
+  0x1F, 0xFC, 0x00, // ...###########...
+  0x07, 0xF0, 0x00, // .....#######.....
+  0x03, 0xE0, 0x00, // ......#####......
+  0x01, 0xC0, 0x00, // .......###.......
+  0x00, 0x80, 0x00, // ........#........
+};
+static const Sprite SPR_HEART_4 = { 17, 13, 8, 4, SPR_HEART_4_BITS, SPR_HEART_4_ROT };
+
+// heart, s = 5, 21x16
+static const unsigned char SPR_HEART_5_BITS[] PROGMEM = {
+  0x1F, 0x07, 0xC0, // ...#####.....#####...
+  0x3F, 0x8F, 0xE0, // ..#######...#######..
+  0x7F, 0xDF, 0xF0, // .#########.#########.
+  0xFF, 0xFF, 0xF8, // #####################
+  0xFF, 0xFF, 0xF8, // #####################
+  0xFF, 0xFF, 0xF8, // #####################
+  0xFF, 0xFF, 0xF8, // #####################
+  0xFF, 0xFF, 0xF8, // #####################
+  0x7F, 0xFF, 0xF0, // .###################.
+  0x3F, 0xFF, 0xE0, // ..#################..
+  0x1F, 0xFF, 0xC0, // ...###############...
+  0x03, 0xFE, 0x00, // ......#########......
+  0x01, 0xFC, 0x00, // .......#######.......
+  0x00, 0xF8, 0x00, // ........#####........
+  0x00, 0x70, 0x00, // .........###.........
+  0x00, 0x20, 0x00, // ..........#..........
+};
+static const Sprite SPR_HEART_5 = { 21, 16, 10, 5, SPR_HEART_5_BITS, SPR_HEART_5_ROT };
+
+// ── Night sky ───────────────────────────────────────────────
+
+// crescent moon, r = 14, 28x29
+static const unsigned char SPR_MOON_BITS[] PROGMEM = {
+  0x00, 0x18, 0x00, 0x00,       // ...........##...............
+  0x00, 0xF0, 0x00, 0x00,       // ........####................
+  0x01, 0xF0, 0x00, 0x00,       // .......#####................
+  0x07, 0xE0, 0x00, 0x00,       // .....######.................
+  0x0F, 0xE0, 0x00, 0x00,       // ....#######.................
+  0x1F, 0xC0, 0x00, 0x00,       // ...#######..................
+  0x1F, 0xC0, 0x00, 0x00,       // ...#######..................
+  0x3F, 0xC0, 0x00, 0x00,       // ..########..................
+  0x7F, 0xC0, 0x00, 0x00,       // .#########..................
+  0x7F, 0xC0, 0x00, 0x00,       // .#########..................
+  0x7F, 0xC0, 0x00, 0x00,       // .#########..................
+  0xFF, 0xC0, 0x00, 0x00,       // ##########..................
+  0xFF, 0xE0, 0x00, 0x00,       // ###########.................
+  0xFF, 0xE0, 0x00, 0x00,       // ###########.................
+  0xFF, 0xF0, 0x00, 0x00,       // ############................
+  0xFF, 0xF0, 0x00, 0x00,       // ############................
+  0xFF, 0xF8, 0x00, 0x00,       // #############...............
+  0xFF, 0xFC, 0x00, 0x00,       // ##############..............
+  0x7F, 0xFE, 0x00, 0x00,       // .##############.............
+  0x7F, 0xFF, 0x80, 0x00,       // .################...........
+  0x7F, 0xFF, 0xE0, 0x30,       // .##################.......##
+  0x3F, 0xFF, 0xFF, 0xE0,       // ..#########################.
+  0x1F, 0xFF, 0xFF, 0xC0,       // ...#######################..
+  0x1F, 0xFF, 0xFF, 0xC0,       // ...#######################..
+  0x0F, 0xFF, 0xFF, 0x80,       // ....#####################...
+  0x07, 0xFF, 0xFF, 0x00,       // .....###################....
+  0x01, 0xFF, 0xFC, 0x00,       // .......###############......
+  0x00, 0xFF, 0xF8, 0x00,       // ........#############.......
+  0x00, 0x1F, 0xC0, 0x00,       // ...........#######..........
+};
+static const Sprite SPR_MOON = { 28, 29, 14, 14, SPR_MOON_BITS, SPR_MOON_ROT };
@@ -0,0 +1,200 @@
+#pragma once
+/*
+ * sprites_rot.h — column-major copies of the sprites in
+ * sprites.h for the landscape rotations. Generated by
+ * tools/spriterot; do not edit.
+ */
+
+// 5x5: 5 columns x 1 bytes
+static const unsigned char SPR_SPARKLE_2_ROT[] PROGMEM = {
+  0x20,
+  0x20,
+  0xF8,
+  0x20,
+  0x20,
+};
+
+// 7x7: 7 columns x 1 bytes
+static const unsigned char SPR_SPARKLE_3_ROT[] PROGMEM = {
+  0x10,
+  0x10,
+  0x10,
+  0xFE,
+  0x10,
+  0x10,
+  0x10,
+};
+
+// 9x9: 9 columns x 2 bytes
+static const unsigned char SPR_SPARKLE_4_ROT[] PROGMEM = {
+  0x08, 0x00,
+  0x08, 0x00,
+  0x08, 0x00,
+  0x08, 0x00,
+  0xFF, 0x80,
+  0x08, 0x00,
+  0x08, 0x00,
+  0x08, 0x00,
+  0x08, 0x00,
+};
+
+// 11x11: 11 columns x 2 bytes
+static const unsigned char SPR_SPARKLE_5_ROT[] PROGMEM = {
+  0x04, 0x00,
+  0x04, 0x00,
+  0x04, 0x00,
+  0x04, 0x00,
+  0x04, 0x00,
+  0xFF, 0xE0,
+  0x04, 0x00,
+  0x04, 0x00,
+  0x04, 0x00,
+  0x04, 0x00,
+  0x04, 0x00,
+};
+
+// 11x11: 11 columns x 2 bytes
+static const unsigned char SPR_ANGER_4_ROT[] PROGMEM = {
+  0xE0, 0xE0,
+  0xF1, 0xE0,
+  0xFB, 0xE0,
+  0x7F, 0xC0,
+  0x3F, 0x80,
+  0x1F, 0x00,
+  0x3F, 0x80,
+  0x7F, 0xC0,
+  0xFB, 0xE0,
+  0xF1, 0xE0,
+  0xE0, 0xE0,
+};
+
+// 13x13: 13 columns x 2 bytes
+static const unsigned char SPR_ANGER_5_ROT[] PROGMEM = {
+  0xE0, 0x38,
+  0xF0, 0x78,
+  0xF8, 0xF8,
+  0x7D, 0xF0,
+  0x3F, 0xE0,
+  0x1F, 0xC0,
+  0x0F, 0x80,
+  0x1F, 0xC0,
+  0x3F, 0xE0,
+  0x7D, 0xF0,
+  0xF8, 0xF8,
+  0xF0, 0x78,
+  0xE0, 0x38,
+};
+
+// 15x15: 15 columns x 2 bytes
+static const unsigned char SPR_ANGER_6_ROT[] PROGMEM = {
+  0xE0, 0x0E,
+  0xF0, 0x1E,
+  0xF8, 0x3E,
+  0x7C, 0x7C,
+  0x3E, 0xF8,
+  0x1F, 0xF0,
+  0x0F, 0xE0,
+  0x07, 0xC0,
+  0x0F, 0xE0,
+  0x1F, 0xF0,
+  0x3E, 0xF8,
+  0x7C, 0x7C,
+  0xF8, 0x3E,
+  0xF0, 0x1E,
+  0xE0, 0x0E,
+};
+
+// 13x10: 13 columns x 2 bytes
+static const unsigned char SPR_HEART_3_ROT[] PROGMEM = {
+  0x38, 0x00,
+  0x7C, 0x00,
+  0xFE, 0x00,
+  0xFE, 0x00,
+  0xFF, 0x00,
+  0x7F, 0x80,
+  0x3F, 0xC0,
+  0x7F, 0x80,
+  0xFF, 0x00,
+  0xFE, 0x00,
+  0xFE, 0x00,
+  0x7C, 0x00,
+  0x38, 0x00,
+};
+
+// 17x13: 17 columns x 2 bytes
+static const unsigned char SPR_HEART_4_ROT[] PROGMEM = {
+  0x1C, 0x00,
+  0x3E, 0x00,
+  0x7F, 0x00,
+  0xFF, 0x80,
+  0xFF, 0x80,
+  0xFF, 0xC0,
+  0x7F, 0xE0,
+  0x3F, 0xF0,
+  0x1F, 0xF8,
+  0x3F, 0xF0,
+  0x7F, 0xE0,
+  0xFF, 0xC0,
+  0xFF, 0x80,
+  0xFF, 0x80,
+  0x7F, 0x00,
+  0x3E, 0x00,
+  0x1C, 0x00,
+};
+
+// 21x16: 21 columns x 2 bytes
+static const unsigned char SPR_HEART_5_ROT[] PROGMEM = {
+  0x1F, 0x00,
+  0x3F, 0x80,
+  0x7F, 0xC0,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  0xFF, 0xF0,
+  0xFF, 0xF8,
+  0x7F, 0xFC,
+  0x3F, 0xFE,
+  0x1F, 0xFF,
+  0x3F, 0xFE,
+  0x7F, 0xFC,
+  0xFF, 0xF8,
+  0xFF, 0xF0,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  0xFF, 0xE0,
+  0x7F, 0xC0,
+  0x3F, 0x80,
+  0x1F, 0x00,
+};
+
+// 28x29: 28 columns x 4 bytes
+static const unsigned char SPR_MOON_ROT[] PROGMEM = {
+  0x00, 0x1F, 0xC0, 0x00,
+  0x00, 0xFF, 0xF8, 0x00,
+  0x01, 0xFF, 0xFC, 0x00,
+  0x07, 0xFF, 0xFF, 0x00,
+  0x0F, 0xFF, 0xFF, 0x80,
+  0x1F, 0xFF, 0xFF, 0xC0,
+  0x1F, 0xFF, 0xFF, 0xC0,
+  0x3F, 0xFF, 0xFF, 0xE0,
+  0x7F, 0xFF, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xFF, 0xF0,
+  0x78, 0x0F, 0xFF, 0xF0,
+  0xE0, 0x03, 0xFF, 0xF8,
+  0x80, 0x00, 0xFF, 0xF8,
+  0x00, 0x00, 0x7F, 0xF8,
+  0x00, 0x00, 0x3F, 0xF8,
+  0x00, 0x00, 0x1F, 0xF8,
+  0x00, 0x00, 0x1F, 0xF8,
+  0x00, 0x00, 0x0F, 0xF8,
+  0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x07, 0xF0,
+  0x00, 0x00, 0x07, 0xF0,
+  0x00, 0x00, 0x07, 0xE0,
+  0x00, 0x00, 0x07, 0xC0,
+  0x00, 0x00, 0x07, 0xC0,
+  0x00, 0x00, 0x07, 0x80,
+  0x00, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x0C, 0x00,
+  0x00, 0x00, 0x08, 0x00,
+};
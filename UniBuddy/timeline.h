@@ -0,0 +1,52 @@
+#pragma once
+/*
+ * ============================================================
+ *  timeline.h — Keyframe clips with a known next-change time
+ *
+ *  A clip is a PROGMEM array of keyframes, each holding one
+ *  pose for a number of ms; it loops. A Timeline plays one clip
+ *  and knows the millis() of its next keyframe, so callers can
+ *  sleep until then instead of polling an animation clock.
+ * ============================================================
+ */
+#include <Arduino.h>
+
+struct Keyframe {
+  uint16_t holdMs;             // how long `pose` stays on screen
+  uint8_t  pose;
+};
+
+struct Timeline {
+  const Keyframe* clip;        // PROGMEM
+  uint8_t  length;
+  uint8_t  index;
+  uint32_t due;                // millis() of the next keyframe
+};
+
+static uint16_t keyHoldMs(const Keyframe* k) { return pgm_read_word(&k->holdMs); }
+
+/* start `clip` at its first keyframe */
+void timelinePlay(Timeline& t, const Keyframe* clip, uint8_t length, uint32_t now) {
+  t.clip   = clip;
+  t.length = length;
+  t.index  = 0;
+  t.due    = now + keyHoldMs(&clip[0]);
+}
+
+/* move to the next keyframe once it is due; true if it did. Keyframes
+ * are scheduled from the previous deadline, not from `now`, so a late
+ * call does not stretch the clip; a very late one restarts the hold */
+bool timelineAdvance(Timeline& t, uint32_t now) {
+  if ((int32_t)(now - t.due) < 0) return false;
+  t.index = (t.index + 1) % t.length;
+  uint16_t hold = keyHoldMs(&t.clip[t.index]);
+  t.due = (now - t.due < hold) ? t.due + hold : now + hold;
+  return true;
+}
+
+uint8_t timelinePose(const Timeline& t) { return pgm_read_byte(&t.clip[t.index].pose); }
+
+/* ms until the next keyframe, 0 if it is due */
+uint32_t timelineMsLeft(const Timeline& t, uint32_t now) {
+  return (int32_t)(t.due - now) > 0 ? t.due - now : 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * ============================================================
+ *  epdrle.cpp — Encode a 1-bit image for Epd::WriteRamRLE
+ *
+ *  Reads a binary PBM (P4, e.g. a frame written by epdsim) and
+ *  prints a PROGMEM C array in the run-length format described
+ *  in epd2in13_V4.h. Pixels are converted to panel RAM polarity
+ *  (bit 1 = white); rows keep the PBM padding, so a 122 px wide
+ *  image has the panel's 16-byte stride. The encoded stream is
+ *  decoded again and checked before anything is printed.
+ *
+ *  Build & run from the repository root:
+ *    g++ -O2 tools/epdrle/epdrle.cpp -o epdrle
+ *    ./epdrle epdsim_out/splash_0000.pbm SPLASH_RLE > UniBuddy/splash_rle.c
+ * ============================================================
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+typedef std::vector<unsigned char> Bytes;
+
+static const int MAX_LITERAL = 0x7F;
+static const int MAX_RUN     = 0x40;
+
+/* next header token of a PBM, skipping whitespace and comments */
+static int pbmInt(FILE* f) {
+  int c = fgetc(f);
+  while (c == '#' || c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+    if (c == '#') while (c != '\n' && c != EOF) c = fgetc(f);
+    c = fgetc(f);
+  }
+  int v = 0;
+  while (c >= '0' && c <= '9') { v = v * 10 + (c - '0'); c = fgetc(f); }
+  return v;
+}
+
+static bool readPbm(const char* path, int& w, int& h, Bytes& ram) {
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  if (fgetc(f) != 'P' || fgetc(f) != '4') { fclose(f); return false; }
+  w = pbmInt(f);
+  h = pbmInt(f);          // consumes the single whitespace before the data
+  ram.resize((size_t)((w + 7) / 8) * h);
+  size_t n = fread(&ram[0], 1, ram.size(), f);
+  fclose(f);
+  if (n != ram.size()) return false;
+  for (size_t i = 0; i < ram.size(); i++) ram[i] = ~ram[i];   // PBM 1 = black
+  return true;
+}
+
+static size_t runLength(const Bytes& in, size_t i) {
+  size_t n = 1;
+  while (i + n < in.size() && in[i + n] == in[i] && n < (size_t)MAX_RUN) n++;
+  return n;
+}
+
+static Bytes encode(const Bytes& in) {
+  Bytes out;
+  size_t lit = 0;                          // index of the open literal header
+  bool   open = false;
+  for (size_t i = 0; i < in.size(); ) {
+    size_t run = runLength(in, i);
+    if (in[i] == 0xFF || run >= 2) {
+      open = false;
+      if (in[i] == 0xFF) {
+        out.push_back(0x80 | (run - 1));
+      } else {
+        out.push_back(0xC0 | (run - 1));
+        out.push_back(in[i]);
+      }
+      i += run;
+      continue;
+    }
+    if (!open || out[lit] == MAX_LITERAL) {
+      lit = out.size();
+      out.push_back(0);
+      open = true;
+    }
+    out[lit]++;
+    out.push_back(in[i++]);
+  }
+  out.push_back(0x00);
+  return out;
+}
+
+/* mirror of Epd::WriteRamRLE */
+static Bytes decode(const Bytes& rle) {
+  Bytes out;
+  for (size_t i = 0; ; ) {
+    unsigned char c = rle[i++];
+    if (c == 0x00) break;
+    if (c < 0x80) {
+      out.insert(out.end(), rle.begin() + i, rle.begin() + i + c);
+      i += c;
+    } else if (c < 0xC0) {
+      out.insert(out.end(), (c & 0x3F) + 1, 0xFF);
+    } else {
+      out.insert(out.end(), (c & 0x3F) + 1, rle[i++]);
+    }
+  }
+  return out;
+}
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: %s image.pbm NAME > name.c\n", argv[0]);
+    return 2;
+  }
+  int w, h;
+  Bytes ram;
+  if (!readPbm(argv[1], w, h, ram)) {
+    fprintf(stderr, "%s: not a readable P4 PBM\n", argv[1]);
+    return 1;
+  }
+  Bytes rle = encode(ram);
+  if (decode(rle) != ram) {
+    fprintf(stderr, "%s: round trip failed\n", argv[1]);
+    return 1;
+  }
+
+  printf("/* %s: %dx%d, %u bytes raw, %u bytes RLE (tools/epdrle)\n",
+         argv[2], w, h, (unsigned)ram.size(), (unsigned)rle.size());
+  printf(" * extern const unsigned char %s[];\n */\n", argv[2]);
+  printf("#include <avr/pgmspace.h>\n\n");
+  printf("const unsigned char %s[] PROGMEM = {", argv[2]);
+  for (size_t i = 0; i < rle.size(); i++)
+    printf("%s0x%02X,", i % 12 ? " " : "\n\t", rle[i]);
+  printf("\n};\n");
+  fprintf(stderr, "%s: %u -> %u bytes\n", argv[2],
+          (unsigned)ram.size(), (unsigned)rle.size());
+  return 0;
+}
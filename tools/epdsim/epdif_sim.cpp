@@ -0,0 +1,202 @@
+/*
+ * ============================================================
+ *  epdif_sim.cpp — Host implementation of EpdIf (see epdif_sim.h)
+ *
+ *  Decoded commands:
+ *    0x10 deep sleep     0x11 data entry (X+, Y+ assumed)
+ *    0x22 update ctrl    0x20 activate   0x32 LUT (timing only)
+ *    0x24/0x26 RAM       0x44/0x45 window 0x4E/0x4F cursor
+ *  Everything else is counted on the wire and ignored.
+ * ============================================================
+ */
+#include "epdif.h"
+#include "epdif_sim.h"
+
+uint32_t  _simMillis = 0;
+SimSerial Serial;
+
+EpdSimStats epdsimTotals;
+
+static const int RAM_STRIDE = 16;          // 128 px / 8
+static const int RAM_ROWS   = 250;
+static const int PANEL_PX   = 122;            // visible columns
+
+static unsigned char _ramBW[RAM_STRIDE * RAM_ROWS];   // 0x24
+static unsigned char _ramRed[RAM_STRIDE * RAM_ROWS];  // 0x26 (mode-2 "old")
+static unsigned char _lut[153];
+
+static int  _dc = HIGH, _rst = HIGH;
+static bool _asleep = false;
+static uint8_t  _cmd = 0;
+static unsigned _arg = 0;                  // data byte index within _cmd
+static uint8_t  _xs = 0, _xe = RAM_STRIDE - 1, _xc = 0;
+static uint16_t _ys = 0, _ye = RAM_ROWS - 1, _yc = 0;
+static uint8_t  _ctrl = 0xF7;
+static uint32_t _busyUntil = 0;
+
+static const char* _outDir = NULL;
+static const char* _prefix = "frame";
+static bool _verbose = true;
+static unsigned long _frameNo = 0;
+static EpdSimStats _atLastRefresh;
+
+void epdsimSetOutput(const char* dir)    { _outDir = dir; }
+void epdsimSetPrefix(const char* prefix) { _prefix = prefix; }
+void epdsimSetVerbose(bool on)           { _verbose = on; }
+
+/* waveform time from the loaded LUT: sum of TP phases x repeats at
+ * ~50 Hz; OTP waveforms use typical datasheet timings */
+static uint32_t waveformMs(uint8_t ctrl) {
+  if (ctrl & 0x10) return (ctrl & 0x08) ? 500 : 2000;   // OTP partial / full
+  if (!(ctrl & 0x08)) return 1500;                      // FAST (0xC7)
+  unsigned long frames = 0;
+  for (int g = 0; g < 12; g++) {
+    const unsigned char* p = &_lut[60 + g * 7];
+    frames += (unsigned long)(p[0] + p[1] + p[3] + p[4]) * (p[6] + 1);
+  }
+  return frames * 20;
+}
+
+static void writePbm() {
+  if (!_outDir) return;
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s_%04lu.pbm", _outDir, _prefix, _frameNo);
+  FILE* f = fopen(path, "wb");
+  if (!f) return;
+  /* RAM bit 1 = white, PBM bit 1 = black; 122 px rows pad to 16 bytes */
+  fprintf(f, "P4\n%d %d\n", PANEL_PX, RAM_ROWS);
+  for (int i = 0; i < RAM_STRIDE * RAM_ROWS; i++) fputc(~_ramBW[i] & 0xFF, f);
+  fclose(f);
+}
+
+static void activate() {
+  if (!(_ctrl & 0x04)) return;             // clock/LUT load only, no display
+
+  uint32_t ms = waveformMs(_ctrl);
+  const char* kind;
+  if (_ctrl & 0x08)      { kind = "PART"; epdsimTotals.part++; }
+  else if (_ctrl & 0x10) { kind = "FULL"; epdsimTotals.full++; }
+  else                   { kind = "FAST"; epdsimTotals.fast++; }
+
+  /* mode 2 compares 0x24 against 0x26, then keeps 0x24 as the new old */
+  memcpy(_ramRed, _ramBW, sizeof(_ramBW));
+  epdsimTotals.refreshes++;
+  epdsimTotals.busyMs += ms;
+  _busyUntil = millis() + ms;
+  _frameNo++;
+  writePbm();
+
+  if (_verbose) {
+    printf("[sim] #%lu %s wf=0x%02X spi=%lu B ram=%lu B windows=%lu busy=%lu ms\n",
+           _frameNo, kind, _ctrl,
+           epdsimTotals.spiBytes - _atLastRefresh.spiBytes,
+           epdsimTotals.ramBytes - _atLastRefresh.ramBytes,
+           epdsimTotals.windows  - _atLastRefresh.windows,
+           (unsigned long)ms);
+  }
+  _atLastRefresh = epdsimTotals;
+}
+
+static void ramWrite(unsigned char* ram, unsigned char data) {
+  if (_xc < RAM_STRIDE && _yc < RAM_ROWS) ram[_xc + _yc * RAM_STRIDE] = data;
+  epdsimTotals.ramBytes++;
+  if (++_xc > _xe) {
+    _xc = _xs;
+    if (++_yc > _ye) _yc = _ys;
+  }
+}
+
+static void command(unsigned char c) {
+  _cmd = c;
+  _arg = 0;
+  if (c == 0x24 || c == 0x26) epdsimTotals.windows++;
+  if (c == 0x20) activate();
+}
+
+static void data(unsigned char d) {
+  switch (_cmd) {
+    case 0x10: if (d & 0x03) { _asleep = true; epdsimTotals.sleeps++; } break;
+    case 0x22: _ctrl = d; break;
+    case 0x24: ramWrite(_ramBW, d);  break;
+    case 0x26: ramWrite(_ramRed, d); break;
+    case 0x32: if (_arg < sizeof(_lut)) _lut[_arg] = d; break;
+    case 0x44:
+      if (_arg == 0) _xs = d;
+      else if (_arg == 1) _xe = d;
+      break;
+    case 0x45:
+      if (_arg == 0) _ys = d;
+      else if (_arg == 1) _ys |= d << 8;
+      else if (_arg == 2) _ye = d;
+      else if (_arg == 3) _ye |= d << 8;
+      break;
+    case 0x4E: _xc = d; break;
+    case 0x4F:
+      if (_arg == 0) _yc = d;
+      else if (_arg == 1) _yc |= d << 8;
+      break;
+    default: break;
+  }
+  _arg++;
+}
+
+static void transfer(unsigned char b) {
+  epdsimTotals.spiBytes++;
+  if (_asleep) {
+    printf("[sim] WARNING: 0x%02X sent while in deep sleep\n", b);
+    return;
+  }
+  if (_dc == LOW) command(b);
+  else data(b);
+}
+
+// ── Arduino pin I/O ─────────────────────────────────────────
+
+void digitalWrite(int pin, int value) {
+  if (pin == DC_PIN) _dc = value;
+  if (pin == RST_PIN) {
+    if (_rst == LOW && value == HIGH) _asleep = false;   // reset wakes
+    _rst = value;
+  }
+}
+
+int digitalRead(int pin) {
+  if (pin == BUSY_PIN) return millis() < _busyUntil ? HIGH : LOW;
+  return HIGH;
+}
+
+// ── EpdIf ───────────────────────────────────────────────────
+
+EpdIf::EpdIf() {
+};
+
+EpdIf::~EpdIf() {
+};
+
+void EpdIf::DigitalWrite(int pin, int value) {
+    digitalWrite(pin, value);
+}
+
+int EpdIf::DigitalRead(int pin) {
+    return digitalRead(pin);
+}
+
+void EpdIf::DelayMs(unsigned int delaytime) {
+    delay(delaytime);
+}
+
+void EpdIf::SpiTransfer(unsigned char data) {
+    transfer(data);
+}
+
+void EpdIf::SpiTransfer(const unsigned char* data, unsigned int len, unsigned char mask) {
+    while (len--) transfer(*data++ ^ mask);
+}
+
+void EpdIf::SpiTransferRepeat(unsigned char data, unsigned int len) {
+    while (len--) transfer(data);
+}
+
+int EpdIf::IfInit(void) {
+    return 0;
+}
@@ -0,0 +1,30 @@
+#pragma once
+/*
+ * ============================================================
+ *  epdif_sim.h — Simulated SSD1680 behind the EpdIf interface
+ *
+ *  epdif_sim.cpp replaces UniBuddy/epdif.cpp on the host. It decodes
+ *  the command/data stream Epd emits, keeps the panel RAM, runs a
+ *  fake BUSY line and writes every refreshed frame as a PBM.
+ * ============================================================
+ */
+#include <stdint.h>
+
+struct EpdSimStats {
+  unsigned long spiBytes;     // every byte clocked out (commands + data)
+  unsigned long ramBytes;     // bytes written into RAM 0x24 / 0x26
+  unsigned long windows;      // RAM write bursts (one per 0x24/0x26 command)
+  unsigned long refreshes;    // 0x20 activations that drove the panel
+  unsigned long full, fast, part;
+  unsigned long busyMs;       // simulated waveform time
+  unsigned long sleeps;       // deep-sleep entries
+};
+
+extern EpdSimStats epdsimTotals;
+
+/* PBM output: frames go to <dir>/<prefix>_NNNN.pbm; dir NULL = none */
+void epdsimSetOutput(const char* dir);
+void epdsimSetPrefix(const char* prefix);
+
+/* per-refresh log lines on stdout */
+void epdsimSetVerbose(bool on);
@@ -0,0 +1,126 @@
+/*
+ * ============================================================
+ *  epdsim_main.cpp — Render every UniBuddy screen on the host
+ *
+ *  Runs each screen of epaper.h through the real renderer and
+ *  Waveshare driver against the simulated panel (epdif_sim.cpp):
+ *  one mode-transition refresh, then partial ticks the way loop()
+ *  drives them (second-aligned on timer screens). Prints bytes on the wire and
+ *  refresh counts per screen; frames are written as PBM.
+ *
+ *  Build & run from the repository root:
+ *    g++ -O2 -Itools/epdsim/shim -Itools/epdsim/shim/lower -IUniBuddy \
+ *        tools/epdsim/epdif_sim.cpp tools/epdsim/epdsim_main.cpp \
+ *        UniBuddy/epd2in13_V4.cpp UniBuddy/epdpaint.cpp \
+ *        UniBuddy/font*.c -o epdsim
+ *    mkdir -p epdsim_out && ./epdsim epdsim_out [-v]
+ * ============================================================
+ */
+#include "epdif_sim.h"
+#include "epaper.h"
+#include "tilt.h"
+
+struct Scene {
+  const char* name;
+  AppMode     mode;
+  PetMood     mood;
+  bool        night;
+  uint32_t    runMs;
+  uint32_t    toggleMs;      // double tap (night mode) after this long, 0 = never
+};
+
+static const Scene SCENES[] = {
+  { "pet_happy",   MODE_PET,        MOOD_HAPPY,     false, 12000, 0 },
+  { "pet_cute",    MODE_PET,        MOOD_CUTE,      false, 12000, 0 },
+  { "pet_angry",   MODE_PET,        MOOD_ANGRY,     false, 12000, 0 },
+  { "pet_night",   MODE_PET,        MOOD_WORRIED,   true,  12000, 0 },
+  { "sleep",       MODE_SLEEP,      MOOD_ASLEEP,    false, 12000, 0 },
+  { "calendar",    MODE_TEMPTIME_L, MOOD_HAPPY,     false,  5000, 0 },
+  { "focus",       MODE_POMODORO,   MOOD_FOCUSED,   false, 12000, 0 },
+  { "focus_night", MODE_POMODORO,   MOOD_FOCUSED,   true,  12000, 0 },
+  { "focus_long",  MODE_POMODORO,   MOOD_FOCUSED,   false, 90000, 0 },
+  { "break",       MODE_BREAK,      MOOD_HAPPY,     false, 12000, 0 },
+  { "night_flip",  MODE_POMODORO,   MOOD_FOCUSED,   false,  8000, 3000 },
+};
+
+static const uint32_t STEP_MS = 10;
+
+/* loop() step 0 + step 9, minus sensors and input */
+static void runScene(const Scene& sc) {
+  setNightMode(sc.night);
+  setDisplayRotation(rotationForMode(sc.mode, MODE_PET));
+  setPetMood(sc.mood);
+  if (sc.mode == MODE_POMODORO) startPomodoro();
+  if (sc.mode == MODE_BREAK)    startBreak();
+  if (sc.mode == MODE_TEMPTIME_L) updateCalendarReadings();
+  updateAmbientTemp();                       // timers task
+  fullRefresh(sc.mode);
+
+  bool timerActive = (sc.mode == MODE_POMODORO || sc.mode == MODE_BREAK);
+  bool needsRedraw = false;
+  uint32_t shownSecs = TIMER_NO_CHANGE;
+  uint32_t lastDisplay = millis();
+  uint32_t end = millis() + sc.runMs;
+
+  uint32_t toggle = sc.toggleMs ? millis() + sc.toggleMs : 0;
+
+  while (millis() < end) {
+    tickDisplay();
+    if (toggle && millis() >= toggle) {      // loop() step 5, EVT_DOUBLE_TAP
+      toggleNightMode();
+      needsRedraw = true;
+      toggle = 0;
+    }
+    if ((sc.mode == MODE_PET || sc.mode == MODE_SLEEP) && tickPetAnimation())
+      needsRedraw = true;
+    uint32_t lead = displayPartialMs();
+    bool tick = timerActive && timerSecondsLeft(sc.mode, lead) != shownSecs;
+    if ((tick || needsRedraw) && isDisplayReady() &&
+        (tick || millis() - lastDisplay >= 300)) {
+      lastDisplay = millis();
+      if (timerActive) shownSecs = timerSecondsLeft(sc.mode, lead);
+      partialRefresh(sc.mode);
+      needsRedraw = false;
+    }
+    uint32_t next = tick || needsRedraw ? 0 :
+                    timerActive ? timerMsToNextSecond(sc.mode, lead) :
+                    (sc.mode == MODE_PET || sc.mode == MODE_SLEEP) ?
+                    petMsToNextFrame() : DISPLAY_NO_FRAME;
+    idleDisplay(next == TIMER_NO_CHANGE ? DISPLAY_NO_FRAME : next);
+    simAdvanceMs(STEP_MS);
+  }
+  while (!isDisplayReady()) { simAdvanceMs(STEP_MS); tickDisplay(); }
+}
+
+int main(int argc, char** argv) {
+  epdsimSetOutput(argc > 1 ? argv[1] : NULL);
+  epdsimSetVerbose(argc > 2);
+
+  epdsimSetPrefix("splash");
+  initDisplay();
+  showSplashScreen();
+
+  printf("%-12s %6s %6s %5s %5s %5s %5s %8s %8s %8s %9s\n", "screen", "ms",
+         "refr", "full", "fast", "part", "skip", "spi B", "ram B", "busy ms",
+         "asleep ms");
+  for (unsigned i = 0; i < sizeof(SCENES) / sizeof(SCENES[0]); i++) {
+    const Scene& sc = SCENES[i];
+    EpdSimStats before = epdsimTotals;
+    uint32_t asleepBefore = displayAsleepMs();
+    uint32_t skippedBefore = displayFramesSkipped();
+    epdsimSetPrefix(sc.name);
+    runScene(sc);
+    printf("%-12s %6lu %6lu %5lu %5lu %5lu %5lu %8lu %8lu %8lu %9lu\n", sc.name,
+           (unsigned long)sc.runMs,
+           epdsimTotals.refreshes - before.refreshes,
+           epdsimTotals.full - before.full,
+           epdsimTotals.fast - before.fast,
+           epdsimTotals.part - before.part,
+           (unsigned long)(displayFramesSkipped() - skippedBefore),
+           epdsimTotals.spiBytes - before.spiBytes,
+           epdsimTotals.ramBytes - before.ramBytes,
+           epdsimTotals.busyMs - before.busyMs,
+           (unsigned long)(displayAsleepMs() - asleepBefore));
+  }
+  return 0;
+}
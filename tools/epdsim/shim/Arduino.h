@@ -0,0 +1,66 @@
+#pragma once
+/*
+ * ============================================================
+ *  Arduino.h — host shim for the e-paper simulator
+ *
+ *  Just enough of the Arduino core for epaper.h and the Waveshare
+ *  driver to compile on Linux. Time is simulated: millis() only
+ *  advances through delay()/simAdvanceMs().
+ * ============================================================
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "avr/pgmspace.h"
+
+#define HIGH          1
+#define LOW           0
+#define INPUT         0
+#define OUTPUT        1
+#define INPUT_PULLUP  2
+#define CHANGE        1
+#define FALLING       2
+#define RISING        3
+#define MSBFIRST      1
+#define SPI_MODE0     0
+
+#define F(s) (s)
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+extern uint32_t _simMillis;
+
+inline uint32_t millis()                 { return _simMillis; }
+inline uint32_t micros()                 { return _simMillis * 1000UL; }
+inline void     simAdvanceMs(uint32_t ms){ _simMillis += ms; }
+inline void     delay(uint32_t ms)       { simAdvanceMs(ms); }
+inline void     delayMicroseconds(uint32_t) {}
+
+inline void pinMode(int, int) {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+inline int  digitalPinToInterrupt(int pin) { return pin; }
+inline void attachInterrupt(int, void (*)(), int) {}
+
+/* pin I/O is routed to the simulated panel (epdif_sim.cpp) */
+void digitalWrite(int pin, int value);
+int  digitalRead(int pin);
+
+struct SimSerial {
+  void begin(long) {}
+  void print(const char* s)          { fputs(s, stdout); }
+  void print(char c)                 { fputc(c, stdout); }
+  void print(int v)                  { printf("%d", v); }
+  void print(unsigned v)             { printf("%u", v); }
+  void print(long v)                 { printf("%ld", v); }
+  void print(unsigned long v)        { printf("%lu", v); }
+  void print(double v, int d = 2)    { printf("%.*f", d, v); }
+  template <class T> void println(T v)        { print(v); fputc('\n', stdout); }
+  template <class T> void println(T v, int d) { print(v, d); fputc('\n', stdout); }
+  void println()                     { fputc('\n', stdout); }
+};
+extern SimSerial Serial;
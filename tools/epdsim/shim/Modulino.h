@@ -0,0 +1,20 @@
+#pragma once
+/* fixed sensor readings: upright, still, 22 °C / 45 % */
+#include "Arduino.h"
+
+struct ModulinoClass { void begin() {} };
+static ModulinoClass Modulino;
+
+struct ModulinoMovement {
+  bool  begin()  { return true; }
+  int   update() { return 1; }
+  float getX()   { return 0.0f; }
+  float getY()   { return -1.0f; }
+  float getZ()   { return 0.0f; }
+};
+
+struct ModulinoThermo {
+  bool  begin()          { return true; }
+  float getTemperature() { return 22.0f; }
+  float getHumidity()    { return 45.0f; }
+};
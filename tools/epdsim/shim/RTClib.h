@@ -0,0 +1,21 @@
+#pragma once
+/* frozen clock: Friday 2026-03-13 14:25 */
+#include "Arduino.h"
+
+struct DateTime {
+  DateTime() {}
+  DateTime(const char*, const char*) {}
+  int year()         const { return 2026; }
+  int month()        const { return 3; }
+  int day()          const { return 13; }
+  int hour()         const { return 14; }
+  int minute()       const { return 25; }
+  int dayOfTheWeek() const { return 5; }
+};
+
+struct RTC_DS1307 {
+  bool     begin()           { return true; }
+  bool     isrunning()       { return true; }
+  void     adjust(DateTime)  {}
+  DateTime now()             { return DateTime(); }
+};
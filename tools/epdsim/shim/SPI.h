@@ -0,0 +1,3 @@
+#pragma once
+/* the simulated EpdIf decodes bytes itself; nothing uses SPI directly */
+#include "Arduino.h"
@@ -0,0 +1,6 @@
+#pragma once
+#include <string.h>
+#define PROGMEM
+#define pgm_read_byte(p)  (*(const unsigned char*)(p))
+#define pgm_read_word(p)  (*(const unsigned short*)(p))
+#define memcpy_P          memcpy
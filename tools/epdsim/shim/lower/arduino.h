@@ -0,0 +1,4 @@
+#pragma once
+/* epdif.h includes <arduino.h>; kept in its own directory so the two
+ * spellings never collide on case-insensitive filesystems */
+#include "../Arduino.h"
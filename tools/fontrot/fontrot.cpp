@@ -0,0 +1,69 @@
+/*
+ * ============================================================
+ *  fontrot.cpp — Generate the column-major font tables
+ *
+ *  Paint::DrawCharAt blits glyphs a row of bytes at a time. In
+ *  the landscape rotations (ROTATE_90 / ROTATE_270) a glyph
+ *  column becomes a framebuffer row, so each glyph is stored a
+ *  second time transposed: Width rows of Height bits, top glyph
+ *  row in the MSB, padding bits zero. Output is fonts_rot.c.
+ *
+ *  Build & run from the repository root:
+ *    g++ -O2 -Itools/epdsim/shim -IUniBuddy tools/fontrot/fontrot.cpp \
+ *        UniBuddy/font8.c UniBuddy/font12.c UniBuddy/font16.c \
+ *        UniBuddy/font20.c UniBuddy/font24.c -o fontrot
+ *    ./fontrot > UniBuddy/fonts_rot.c
+ * ============================================================
+ */
+#include <stdio.h>
+#include "fonts.h"
+
+/* the generator links the font sources before fonts_rot.c exists */
+extern "C" {
+const uint8_t Font8_TableRot[1]  = {0};
+const uint8_t Font12_TableRot[1] = {0};
+const uint8_t Font16_TableRot[1] = {0};
+const uint8_t Font20_TableRot[1] = {0};
+const uint8_t Font24_TableRot[1] = {0};
+}
+
+static const int GLYPHS = '~' - ' ' + 1;
+
+static void emit(const char* name, const sFONT& font) {
+  int rowBytes = (font.Width + 7) / 8;        // source: Height rows
+  int colBytes = (font.Height + 7) / 8;       // output: Width rows
+  printf("\n// %dx%d: %d glyphs x %d columns x %d bytes\n",
+         font.Width, font.Height, GLYPHS, font.Width, colBytes);
+  printf("const uint8_t %s_TableRot[] PROGMEM =\n{", name);
+  for (int c = 0; c < GLYPHS; c++) {
+    const uint8_t* g = &font.table[c * font.Height * rowBytes];
+    printf("\n\t// @%d '%c'\n", c * font.Width * colBytes, ' ' + c);
+    for (int i = 0; i < font.Width; i++) {
+      printf("\t");
+      for (int k = 0; k < colBytes; k++) {
+        uint8_t b = 0;
+        for (int bit = 0; bit < 8; bit++) {
+          int j = k * 8 + bit;
+          if (j < font.Height &&
+              (g[j * rowBytes + i / 8] & (0x80 >> (i % 8))))
+            b |= 0x80 >> bit;
+        }
+        printf("0x%02X,%s", b, k + 1 < colBytes ? " " : "");
+      }
+      printf("\n");
+    }
+  }
+  printf("};\n");
+}
+
+int main() {
+  printf("/*\n * fonts_rot.c — column-major copies of Font8..Font24 for the\n"
+         " * landscape rotations. Generated by tools/fontrot; do not edit.\n */\n");
+  printf("#include \"fonts.h\"\n#include <avr/pgmspace.h>\n");
+  emit("Font8",  Font8);
+  emit("Font12", Font12);
+  emit("Font16", Font16);
+  emit("Font20", Font20);
+  emit("Font24", Font24);
+  return 0;
+}
@@ -0,0 +1,65 @@
+/*
+ * ============================================================
+ *  spriterot.cpp — Generate the column-major sprite copies
+ *
+ *  Paint::DrawBitmap writes a sprite a panel row at a time. In
+ *  the landscape rotations (ROTATE_90 / ROTATE_270) a sprite
+ *  column becomes a panel row, so each sprite is stored a second
+ *  time transposed: w rows of h bits, top sprite row in the MSB,
+ *  padding bits zero. Output is sprites_rot.h.
+ *
+ *  Build & run from the repository root:
+ *    g++ -O2 -Itools/epdsim/shim -IUniBuddy \
+ *        tools/spriterot/spriterot.cpp -o spriterot
+ *    ./spriterot > UniBuddy/sprites_rot.h
+ * ============================================================
+ */
+#include <stdio.h>
+
+/* sprites.h refers to the copies this tool is about to write */
+#define SPRITES_ROT_STUBS
+#define STUB(n) static const unsigned char n[1] = {0};
+STUB(SPR_SPARKLE_2_ROT) STUB(SPR_SPARKLE_3_ROT) STUB(SPR_SPARKLE_4_ROT)
+STUB(SPR_SPARKLE_5_ROT) STUB(SPR_ANGER_4_ROT)   STUB(SPR_ANGER_5_ROT)
+STUB(SPR_ANGER_6_ROT)   STUB(SPR_HEART_3_ROT)   STUB(SPR_HEART_4_ROT)
+STUB(SPR_HEART_5_ROT)   STUB(SPR_MOON_ROT)
+#include "sprites.h"
+
+static void emit(const char* name, const Sprite& s) {
+  int rowBytes = (s.w + 7) / 8;               // source: h rows
+  int colBytes = (s.h + 7) / 8;               // output: w rows
+  printf("\n// %dx%d: %d columns x %d bytes\n", s.w, s.h, s.w, colBytes);
+  printf("static const unsigned char %s_ROT[] PROGMEM = {\n", name);
+  for (int i = 0; i < s.w; i++) {
+    printf(" ");
+    for (int k = 0; k < colBytes; k++) {
+      unsigned char b = 0;
+      for (int bit = 0; bit < 8; bit++) {
+        int j = k * 8 + bit;
+        if (j < s.h && (s.bits[j * rowBytes + i / 8] & (0x80 >> (i % 8))))
+          b |= 0x80 >> bit;
+      }
+      printf(" 0x%02X,", b);
+    }
+    printf("\n");
+  }
+  printf("};\n");
+}
+
+int main() {
+  printf("#pragma once\n/*\n * sprites_rot.h — column-major copies of the sprites in\n"
+         " * sprites.h for the landscape rotations. Generated by\n"
+         " * tools/spriterot; do not edit.\n */\n");
+  emit("SPR_SPARKLE_2", SPR_SPARKLE_2);
+  emit("SPR_SPARKLE_3", SPR_SPARKLE_3);
+  emit("SPR_SPARKLE_4", SPR_SPARKLE_4);
+  emit("SPR_SPARKLE_5", SPR_SPARKLE_5);
+  emit("SPR_ANGER_4",   SPR_ANGER_4);
+  emit("SPR_ANGER_5",   SPR_ANGER_5);
+  emit("SPR_ANGER_6",   SPR_ANGER_6);
+  emit("SPR_HEART_3",   SPR_HEART_3);
+  emit("SPR_HEART_4",   SPR_HEART_4);
+  emit("SPR_HEART_5",   SPR_HEART_5);
+  emit("SPR_MOON",      SPR_MOON);
+  return 0;
+}